@@ -0,0 +1,430 @@
+// Complex Matrices Library, for complex matrix operations
+// Implementation file
+// by Neo Vorsatz
+// Last updated: 16 October 2026
+
+#include "complex_matrices.h"
+
+#define __ABS(x) (((x)<0)? -(x):(x))
+
+/* CREATING ================================*/
+
+//Sets the size and elements of a complex matrix, from complex numbers
+bool cxSet(cmatrix *write, int rows, int columns, complex elements[CX_SIZE][CX_SIZE]) {
+  //If the given rows or columns are too big
+  if ((rows>CX_SIZE)||(columns>CX_SIZE)) {return false;}
+
+  //Set the size
+  write->rows = rows;
+  write->columns = columns;
+  //For each element
+  for (unsigned int r=0; r<rows; r++) {
+    for (unsigned int c=0; c<columns; c++) {
+      //Split the element into the planes (in rectangular form)
+      write->real[r][c] = cnReal(&elements[r][c]);
+      write->imag[r][c] = cnImag(&elements[r][c]);
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Sets the size and elements of a complex matrix, from separate real and imaginary parts
+bool cxSetParts(cmatrix *write, int rows, int columns, double real[CX_SIZE][CX_SIZE], double imag[CX_SIZE][CX_SIZE]) {
+  //If the given rows or columns are too big
+  if ((rows>CX_SIZE)||(columns>CX_SIZE)) {return false;}
+
+  //Set the size
+  write->rows = rows;
+  write->columns = columns;
+  //For each element
+  for (unsigned int r=0; r<rows; r++) {
+    for (unsigned int c=0; c<columns; c++) {
+      //Copy the parts into the planes
+      write->real[r][c] = real[r][c];
+      write->imag[r][c] = imag[r][c];
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Sets the size of a complex matrix
+bool cxSetSize(cmatrix *write, int rows, int columns) {
+  //If the given rows or columns are too big
+  if ((rows>CX_SIZE)||(columns>CX_SIZE)) {return false;}
+
+  //Setting the size
+  write->rows = rows;
+  write->columns = columns;
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Writes a complex number into the given row and column of a complex matrix
+bool cxWriteElement(cmatrix *write, int row, int column, complex entry) {
+  //If the index is out of bounds
+  if ((row<0)||(column<0)||(row+1>CX_SIZE)||(column+1>CX_SIZE)) {return false;}
+
+  //If the index is beyond the current size, expand the matrix
+  if (row+1>write->rows) {write->rows = row+1;}
+  if (column+1>write->columns) {write->columns = column+1;}
+  //Split the entry into the planes (in rectangular form)
+  write->real[row][column] = cnReal(&entry);
+  write->imag[row][column] = cnImag(&entry);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Copies the second complex matrix onto the first
+void cxCopy(cmatrix *write, const cmatrix *read) {
+  //If they're the same matrix, there's nothing to copy
+  if (write==read) {return;}
+  //Copy the size
+  write->rows = read->rows;
+  write->columns = read->columns;
+  //Copy each element of both planes
+  for (unsigned int r=0; r<read->rows; r++) {
+    for (unsigned int c=0; c<read->columns; c++) {
+      write->real[r][c] = read->real[r][c];
+      write->imag[r][c] = read->imag[r][c];
+    }
+  }
+}
+
+/*================================*/
+/* READING ================================*/
+
+//Returns an element of a complex matrix, in rectangular form
+complex cxReadElement(const cmatrix *read, int row, int column) {
+  //If the index is out of bounds
+  if ((row<0)||(column<0)||(row+1>read->rows)||(column+1>read->columns)) {return cnR(0);}
+  //Combine the planes into a complex number
+  return cnRect(read->real[row][column], read->imag[row][column]);
+}
+
+//Returns whether or not two complex matrices are equal
+bool cxEqual(const cmatrix *read1, const cmatrix *read2, double tolerance) {
+  //If they're different sizes
+  if ((read1->rows!=read2->rows)||(read1->columns!=read2->columns)) {return false;}
+  //For each element
+  for (unsigned int r=0; r<read1->rows; r++) {
+    for (unsigned int c=0; c<read1->columns; c++) {
+      //If either part is too different
+      if (__ABS(read1->real[r][c]-read2->real[r][c])>tolerance) {return false;}
+      if (__ABS(read1->imag[r][c]-read2->imag[r][c])>tolerance) {return false;}
+    }
+  }
+  return true;
+}
+
+/*================================*/
+/* OPERATIONS ================================*/
+
+//Sets all the elements of a complex matrix to 0
+void cxZero(cmatrix *write) {
+  //For each element, clear both planes
+  for (unsigned int r=0; r<CX_SIZE; r++) {
+    for (unsigned int c=0; c<CX_SIZE; c++) {
+      write->real[r][c] = 0;
+      write->imag[r][c] = 0;
+    }
+  }
+}
+
+//Makes a complex matrix into an identity matrix
+bool cxIdentity(cmatrix *write, int size) {
+  //If the size is too large
+  if (size>CX_SIZE) {return false;}
+
+  //Set the size
+  write->rows = size;
+  write->columns = size;
+  //Clear the elements, then put 1s on the diagonal
+  cxZero(write);
+  for (unsigned int i=0; i<size; i++) {write->real[i][i] = 1;}
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Adds two complex matrices together
+bool cxAdd(cmatrix *write, const cmatrix *read1, const cmatrix *read2) {
+  //If the sizes are different
+  if ((read1->rows!=read2->rows)||(read1->columns!=read2->columns)) {return false;}
+
+  //Set the size
+  write->rows = read1->rows;
+  write->columns = read1->columns;
+  //Add each plane separately
+  for (unsigned int r=0; r<read1->rows; r++) {
+    for (unsigned int c=0; c<read1->columns; c++) {
+      write->real[r][c] = read1->real[r][c]+read2->real[r][c];
+      write->imag[r][c] = read1->imag[r][c]+read2->imag[r][c];
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Multiplies a complex matrix by a complex scalar
+void cxScale(cmatrix *write, const cmatrix *read, complex factor) {
+  //The parts of the scalar
+  double a = cnReal(&factor);
+  double b = cnImag(&factor);
+
+  //Set the size
+  write->rows = read->rows;
+  write->columns = read->columns;
+  //For each element, (x+yi)(a+bi) = (ax-by)+(ay+bx)i
+  for (unsigned int r=0; r<read->rows; r++) {
+    for (unsigned int c=0; c<read->columns; c++) {
+      double x = read->real[r][c];
+      double y = read->imag[r][c];
+      write->real[r][c] = a*x-b*y;
+      write->imag[r][c] = a*y+b*x;
+    }
+  }
+}
+
+//Multiplies two complex matrices together
+bool cxMultiply(cmatrix *write, const cmatrix *read1, const cmatrix *read2) {
+  //If the matrices can't be multiplied
+  if (read1->columns!=read2->rows) {return false;}
+
+  //Build the product separately, in case Write is one of the matrices
+  cmatrix product;
+  product.rows = read1->rows;
+  product.columns = read2->columns;
+  //For each row
+  for (unsigned int r=0; r<read1->rows; r++) {
+    //Start the row at 0
+    for (unsigned int c=0; c<read2->columns; c++) {
+      product.real[r][c] = 0;
+      product.imag[r][c] = 0;
+    }
+    //For each term, add the entry of Read1 multiplied by the row of Read2.
+    //Walking along rows of the planes keeps every inner loop contiguous (so the compiler can vectorise it)
+    for (unsigned int i=0; i<read1->columns; i++) {
+      double a = read1->real[r][i];
+      double b = read1->imag[r][i];
+      for (unsigned int c=0; c<read2->columns; c++) {
+        product.real[r][c] += a*read2->real[i][c]-b*read2->imag[i][c];
+        product.imag[r][c] += a*read2->imag[i][c]+b*read2->real[i][c];
+      }
+    }
+  }
+  //Write the product
+  cxCopy(write, &product);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Writes the conjugate transpose of a complex matrix
+void cxConjugateTranspose(cmatrix *write, const cmatrix *read) {
+  //Build the transpose separately, in case Write is the same matrix
+  cmatrix transpose;
+  transpose.rows = read->columns;
+  transpose.columns = read->rows;
+  //For each element, move it across the diagonal and negate the imaginary part
+  for (unsigned int r=0; r<read->rows; r++) {
+    for (unsigned int c=0; c<read->columns; c++) {
+      transpose.real[c][r] = read->real[r][c];
+      transpose.imag[c][r] = -read->imag[r][c];
+    }
+  }
+  //Write the transpose
+  cxCopy(write, &transpose);
+}
+
+/*================================*/
+/* DECOMPOSITIONS ================================*/
+
+//Decomposes a square complex matrix into lower and upper triangular matrices, with partial pivoting
+bool cxLU(cxLUFactor *write, const cmatrix *read) {
+  //If it's not a square matrix
+  if (read->rows!=read->columns) {return false;}
+
+  //Copy the matrix, which will be decomposed in place
+  cxCopy(&write->lu, read);
+  //Start with no row swaps, and not yet usable
+  write->valid = false;
+  write->sign = 1;
+  for (unsigned int r=0; r<read->rows; r++) {write->permutation[r] = r;}
+  //Whether the matrix was found to be singular
+  bool singular = false;
+
+  //Shorthand for the size and the planes
+  unsigned int n = read->rows;
+  double (*re)[CX_SIZE] = write->lu.real;
+  double (*im)[CX_SIZE] = write->lu.imag;
+  //For each column
+  for (unsigned int k=0; k<n; k++) {
+    /* Partial pivoting: pick the entry on or below the diagonal with the largest magnitude (squared, to avoid a square root) */
+    unsigned int p = k;
+    double largest = re[k][k]*re[k][k]+im[k][k]*im[k][k];
+    //For each row below the diagonal
+    for (unsigned int r=k+1; r<n; r++) {
+      double size = re[r][k]*re[r][k]+im[r][k]*im[r][k];
+      //If this entry is larger, note it as the new pivot
+      if (size>largest) {
+        largest = size;
+        p = r;
+      }
+    }
+    //If there is no non-zero pivot, the matrix is singular
+    if (largest==0) {
+      singular = true;
+      continue;
+    }
+
+    //If the pivot isn't on the diagonal
+    if (p!=k) {
+      //Swap the rows, in both planes
+      for (unsigned int c=0; c<n; c++) {
+        double temp = re[k][c];
+        re[k][c] = re[p][c];
+        re[p][c] = temp;
+        temp = im[k][c];
+        im[k][c] = im[p][c];
+        im[p][c] = temp;
+      }
+      //Record the swap
+      unsigned int temp = write->permutation[k];
+      write->permutation[k] = write->permutation[p];
+      write->permutation[p] = temp;
+      write->sign = -write->sign;
+    }
+
+    /* Eliminate below the pivot */
+    //The reciprocal of the pivot, 1/(a+bi) = (a-bi)/(a²+b²)
+    double inverseReal = re[k][k]/largest;
+    double inverseImag = -im[k][k]/largest;
+    //For each row below the pivot
+    for (unsigned int r=k+1; r<n; r++) {
+      //Store the multiplier in the lower triangle
+      double a = re[r][k]*inverseReal-im[r][k]*inverseImag;
+      double b = re[r][k]*inverseImag+im[r][k]*inverseReal;
+      re[r][k] = a;
+      im[r][k] = b;
+      //Decrease the rest of the row by the multiple of the pivot row
+      for (unsigned int c=k+1; c<n; c++) {
+        re[r][c] -= a*re[k][c]-b*im[k][c];
+        im[r][c] -= a*im[k][c]+b*re[k][c];
+      }
+    }
+  }
+
+  //The decomposition can be used to solve, if the matrix isn't singular
+  write->valid = !singular;
+
+  //Indicate whether the process was successful
+  return !singular;
+}
+
+//Solves for all vectors, using a decomposition of the transformation matrix
+bool cxLUSolve(cmatrix *write, const cxLUFactor *factor, const cmatrix *result) {
+  //If the decomposition can't be used, or the result is the wrong size
+  if ((!factor->valid)||(factor->lu.rows!=result->rows)) {return false;}
+
+  //Shorthand for the size and the planes
+  unsigned int n = factor->lu.rows;
+  unsigned int m = result->columns;
+  const double (*re)[CX_SIZE] = factor->lu.real;
+  const double (*im)[CX_SIZE] = factor->lu.imag;
+  //Apply the row swaps to the result
+  cmatrix y;
+  y.rows = n;
+  y.columns = m;
+  for (unsigned int r=0; r<n; r++) {
+    for (unsigned int c=0; c<m; c++) {
+      y.real[r][c] = result->real[factor->permutation[r]][c];
+      y.imag[r][c] = result->imag[factor->permutation[r]][c];
+    }
+  }
+
+  /* Forward substitution, with the unit lower triangle (all vectors at once, row by row) */
+  for (unsigned int r=1; r<n; r++) {
+    for (unsigned int k=0; k<r; k++) {
+      double a = re[r][k];
+      double b = im[r][k];
+      for (unsigned int c=0; c<m; c++) {
+        y.real[r][c] -= a*y.real[k][c]-b*y.imag[k][c];
+        y.imag[r][c] -= a*y.imag[k][c]+b*y.real[k][c];
+      }
+    }
+  }
+
+  /* Back substitution, with the upper triangle */
+  for (unsigned int r=n; r-->0;) {
+    for (unsigned int k=r+1; k<n; k++) {
+      double a = re[r][k];
+      double b = im[r][k];
+      for (unsigned int c=0; c<m; c++) {
+        y.real[r][c] -= a*y.real[k][c]-b*y.imag[k][c];
+        y.imag[r][c] -= a*y.imag[k][c]+b*y.real[k][c];
+      }
+    }
+    //Divide the row by the diagonal, using its reciprocal
+    double size = re[r][r]*re[r][r]+im[r][r]*im[r][r];
+    double a = re[r][r]/size;
+    double b = -im[r][r]/size;
+    for (unsigned int c=0; c<m; c++) {
+      double x = y.real[r][c];
+      y.real[r][c] = a*x-b*y.imag[r][c];
+      y.imag[r][c] = a*y.imag[r][c]+b*x;
+    }
+  }
+
+  //Write the solution
+  cxCopy(write, &y);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Solves for all vectors, using an LU decomposition of the transformation
+bool cxSolve(cmatrix *write, const cmatrix *transform, const cmatrix *result) {
+  //Decompose the transformation
+  cxLUFactor factor;
+  if (!cxLU(&factor, transform)) {return false;}
+  //Solve for the vectors
+  return cxLUSolve(write, &factor, result);
+}
+
+//Writes the inverse of a square complex matrix
+bool cxInverse(cmatrix *write, const cmatrix *read) {
+  //Decompose the matrix
+  cxLUFactor factor;
+  if (!cxLU(&factor, read)) {return false;}
+  //Solve for each column of the identity matrix
+  cmatrix identity;
+  cxIdentity(&identity, read->rows);
+  return cxLUSolve(write, &factor, &identity);
+}
+
+//Returns the determinant of a square complex matrix
+complex cxDeterminant(const cmatrix *read) {
+  //If it's not a square matrix
+  if (read->rows!=read->columns) {return cnR(0);}
+
+  //Decompose the matrix (a singular matrix has a determinant of 0)
+  cxLUFactor factor;
+  if (!cxLU(&factor, read)) {return cnR(0);}
+  //Multiply the diagonal of the upper triangle together, with the sign of the row swaps
+  complex determinant = cnR(factor.sign);
+  for (unsigned int i=0; i<read->rows; i++) {
+    determinant = cnMultiply(determinant, cnRect(factor.lu.real[i][i], factor.lu.imag[i][i]));
+  }
+  return determinant;
+}
+
+/*================================*/
+
+#undef __ABS
@@ -0,0 +1,241 @@
+// Complex Matrices Library, for complex matrix operations
+// Header file
+// by Neo Vorsatz
+// Last updated: 16 October 2026
+
+//Header guard
+#ifndef COMPLEX_MATRICES_H
+#define COMPLEX_MATRICES_H
+
+//Includes
+#include <stdbool.h>
+#include "../c-complex-numbers/complex_numbers.h"
+
+//C++ compatibility
+#ifdef __cplusplus
+  extern "C" {
+#endif
+
+/* EDIT WITH MACROS ================================*/
+
+#ifndef CX_SIZE
+  #define CX_SIZE 4 //This value determines the maximum size of the complex matrices
+#endif
+
+/*================================*/
+/* TYPE DEFINITIONS ================================*/
+
+//Structure for complex matrices, with the real and imaginary parts kept in separate planes (so each plane can be worked on like a real matrix)
+typedef struct {
+  unsigned int rows;
+  unsigned int columns;
+  double real[CX_SIZE][CX_SIZE]; //real parts of the elements
+  double imag[CX_SIZE][CX_SIZE]; //imaginary parts of the elements
+} cmatrix;
+
+//Structure for an LU decomposition (with partial pivoting) of a square complex matrix
+typedef struct {
+  cmatrix lu; //unit lower triangle (below the diagonal) and upper triangle (on and above the diagonal), packed
+  unsigned int permutation[CX_SIZE]; //row of the original matrix that each row of the decomposition came from
+  signed int sign; //sign of the permutation (+1 or -1)
+  bool valid; //whether the decomposition is up to date and can be used to solve
+} cxLUFactor;
+
+/*================================*/
+/* CREATING ================================*/
+
+/**
+ * @brief Sets the size and elements of a complex matrix, from complex numbers
+ * 
+ * @param write A pointer to the complex matrix
+ * @param rows The number of rows
+ * @param columns The number of columns
+ * @param elements A 2D array of complex numbers (in rectangular or polar form)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the size is too big
+ */
+bool cxSet(cmatrix *write, int rows, int columns, complex elements[CX_SIZE][CX_SIZE]);
+
+/**
+ * @brief Sets the size and elements of a complex matrix, from separate real and imaginary parts
+ * 
+ * @param write A pointer to the complex matrix
+ * @param rows The number of rows
+ * @param columns The number of columns
+ * @param real A 2D array of the real parts
+ * @param imag A 2D array of the imaginary parts
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the size is too big
+ */
+bool cxSetParts(cmatrix *write, int rows, int columns, double real[CX_SIZE][CX_SIZE], double imag[CX_SIZE][CX_SIZE]);
+
+/**
+ * @brief Sets the size of a complex matrix
+ * 
+ * @param write A pointer to the complex matrix
+ * @param rows The number of rows
+ * @param columns The number of columns
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the size is too big
+ */
+bool cxSetSize(cmatrix *write, int rows, int columns);
+
+/**
+ * @brief Writes a complex number into the given row and column of a complex matrix (expanding the matrix if needed)
+ * 
+ * @param write A pointer to the complex matrix
+ * @param row The index of the row
+ * @param column The index of the column
+ * @param entry The complex number (in rectangular or polar form)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the index is too big
+ */
+bool cxWriteElement(cmatrix *write, int row, int column, complex entry);
+
+/**
+ * @brief Copies the second complex matrix onto the first
+ * 
+ * @param write A pointer to where the copy will be written
+ * @param read A pointer to the complex matrix
+ */
+void cxCopy(cmatrix *write, const cmatrix *read);
+
+/*================================*/
+/* READING ================================*/
+
+/**
+ * @param read A pointer to the complex matrix
+ * @param row The index of the row
+ * @param column The index of the column
+ * 
+ * @return The element in rectangular form, otherwise returns 0 if the index is out of bounds
+ */
+complex cxReadElement(const cmatrix *read, int row, int column);
+
+/**
+ * @param read1 A pointer to a complex matrix
+ * @param read2 A pointer to another complex matrix
+ * @param tolerance The tolerance to use when comparing the real and imaginary parts
+ * 
+ * @return Whether or not two complex matrices are equal
+ */
+bool cxEqual(const cmatrix *read1, const cmatrix *read2, double tolerance);
+
+/*================================*/
+/* OPERATIONS ================================*/
+
+/**
+ * @brief Sets all the elements of a complex matrix to 0, without changing its size
+ * 
+ * @param write A pointer to the complex matrix
+ */
+void cxZero(cmatrix *write);
+
+/**
+ * @brief Makes a complex matrix into an identity matrix
+ * 
+ * @param write A pointer to the complex matrix
+ * @param size The number of rows and columns
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the size is too big
+ */
+bool cxIdentity(cmatrix *write, int size);
+
+/**
+ * @brief Adds two complex matrices together
+ * 
+ * @param write A pointer to where the result will be written (may be one of the matrices)
+ * @param read1 A pointer to the first complex matrix
+ * @param read2 A pointer to the second complex matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the sizes are different
+ */
+bool cxAdd(cmatrix *write, const cmatrix *read1, const cmatrix *read2);
+
+/**
+ * @brief Multiplies a complex matrix by a complex scalar
+ * 
+ * @param write A pointer to where the result will be written (may be the same matrix)
+ * @param read A pointer to the complex matrix
+ * @param factor The complex scalar (in rectangular or polar form)
+ */
+void cxScale(cmatrix *write, const cmatrix *read, complex factor);
+
+/**
+ * @brief Multiplies two complex matrices together
+ * 
+ * @param write A pointer to where the result will be written (may be one of the matrices)
+ * @param read1 A pointer to the first complex matrix
+ * @param read2 A pointer to the second complex matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the sizes are wrong
+ */
+bool cxMultiply(cmatrix *write, const cmatrix *read1, const cmatrix *read2);
+
+/**
+ * @brief Writes the conjugate transpose (Hermitian transpose) of a complex matrix
+ * 
+ * @param write A pointer to where the result will be written (may be the same matrix)
+ * @param read A pointer to the complex matrix
+ */
+void cxConjugateTranspose(cmatrix *write, const cmatrix *read);
+
+/*================================*/
+/* DECOMPOSITIONS ================================*/
+
+/**
+ * @brief Decomposes a square complex matrix into lower and upper triangular matrices, with partial pivoting
+ * 
+ * @param write A pointer to where the decomposition will be written
+ * @param read A pointer to the complex matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the matrix is not square or is singular
+ */
+bool cxLU(cxLUFactor *write, const cmatrix *read);
+
+/**
+ * @brief Solves for all vectors, using a decomposition of the transformation matrix
+ * 
+ * @param write A pointer to where the solution will be written (may be the result)
+ * @param factor A pointer to the decomposition of the transformation matrix
+ * @param result A pointer to the complex matrix of resulting vectors
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the decomposition can't be used or the sizes are wrong
+ */
+bool cxLUSolve(cmatrix *write, const cxLUFactor *factor, const cmatrix *result);
+
+/**
+ * @brief Solves for all vectors, such as the node voltages of a circuit from its admittance matrix and current sources
+ * 
+ * @param write A pointer to where the solution will be written (may be the result)
+ * @param transform A pointer to the square transformation complex matrix
+ * @param result A pointer to the complex matrix of resulting vectors
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the transformation is singular or the sizes are wrong
+ */
+bool cxSolve(cmatrix *write, const cmatrix *transform, const cmatrix *result);
+
+/**
+ * @brief Writes the inverse of a square complex matrix
+ * 
+ * @param write A pointer to where the inverse will be written (may be the same matrix)
+ * @param read A pointer to the complex matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the matrix is not square or is singular
+ */
+bool cxInverse(cmatrix *write, const cmatrix *read);
+
+/**
+ * @param read A pointer to the square complex matrix
+ * 
+ * @return The determinant in rectangular form, otherwise returns 0 if the matrix is not square
+ */
+complex cxDeterminant(const cmatrix *read);
+
+/*================================*/
+
+#ifdef __cplusplus
+  }
+#endif
+
+#endif
@@ -0,0 +1,69 @@
+// Programme to test the complex matrices library; ComplexMatrices
+// by Neo Vorsatz
+// Last updated: 16 October 2026
+
+#include <stdio.h>
+
+//Test was done with a maximum matrix size of 4 by 4
+#define CX_SIZE 4
+#include "complex_matrices.c"
+#include "../c-complex-numbers/complex_numbers.c"
+
+void printComplex(complex complexNum) {
+  if (complexNum.imag < 0) {
+    printf("%.3f%.3fi", complexNum.real, complexNum.imag); //Print without adding a '+'
+  } else {
+    printf("%.3f+%.3fi", complexNum.real, complexNum.imag); //Print while adding a '+'
+  }
+}
+
+void printMatrix(const cmatrix *read) {
+  for (unsigned int r=0; r<read->rows; r++) {
+    for (unsigned int c=0; c<read->columns; c++) {
+      printComplex(cxReadElement(read, r, c));
+      printf(" ");
+    }
+    printf("\n");
+  }
+}
+
+int main() {
+  /* A circuit with 2 nodes, as an admittance matrix Y and current sources I, so YV=I */
+  cmatrix admittance;
+  complex elements[CX_SIZE][CX_SIZE] = {{cnRect(1,1),cnR(-1)},{cnR(-1),cnRect(2,-0.5)}};
+  cxSet(&admittance, 2, 2, elements);
+  cmatrix current;
+  cxSetSize(&current, 2, 1);
+  cxWriteElement(&current, 0, 0, cnR(1));
+  cxWriteElement(&current, 1, 0, cnR(0));
+
+  //Testing the determinant
+  printf("Determinant: ");
+  printComplex(cxDeterminant(&admittance));
+  printf(" | expected: 1.500+1.500i\n");
+
+  //Testing solving for the node voltages
+  cmatrix voltage;
+  cxSolve(&voltage, &admittance, &current);
+  printf("Node voltages:\n");
+  printMatrix(&voltage);
+  printf("expected:\n0.500-0.833i\n0.333-0.333i\n");
+
+  //Testing the inverse, and multiplying by it
+  cmatrix inverse;
+  cmatrix product;
+  cmatrix identity;
+  cxInverse(&inverse, &admittance);
+  cxMultiply(&product, &admittance, &inverse);
+  cxIdentity(&identity, 2);
+  printf("Matrix times its inverse is the identity: %d | expected: 1\n", cxEqual(&product, &identity, 1e-12));
+
+  //Testing the conjugate transpose of a polar element
+  cxWriteElement(&product, 0, 1, cnPolar(2, 1.5707963267948966));
+  cxConjugateTranspose(&product, &product);
+  printf("Conjugate transpose element: ");
+  printComplex(cxReadElement(&product, 1, 0));
+  printf(" | expected: 0.000-2.000i\n");
+
+  return 0;
+}
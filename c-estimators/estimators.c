@@ -0,0 +1,352 @@
+// Estimators Library, for estimating states from noisy measurements
+// Implementation file
+// by Neo Vorsatz
+// Last updated: 16 October 2026
+
+#include "estimators.h"
+#include <math.h>
+
+/* KALMAN FILTERS ================================*/
+
+//Sets up a Kalman filter
+bool esKalmanInit(esKalman *write, int states, int measurements) {
+  //If either size is empty or too big
+  if ((states<1)||(measurements<1)||(states>MX_SIZE)||(measurements>MX_SIZE)) {return false;}
+
+  //Start with a zero state, and identity covariance and transition
+  mxZero(&write->state);
+  mxSetSize(&write->state, states, 1);
+  mxIdentity(&write->covariance, states);
+  mxIdentity(&write->transition, states);
+  //Start with no process noise, no observation, and identity measurement noise
+  mxZero(&write->processNoise);
+  mxSetSize(&write->processNoise, states, states);
+  mxZero(&write->observation);
+  mxSetSize(&write->observation, measurements, states);
+  mxIdentity(&write->measurementNoise, measurements);
+  //Size the workspace
+  mxSetSize(&write->product, states, states);
+  mxSetSize(&write->crossCovariance, states, measurements);
+  mxSetSize(&write->innovationCovariance, measurements, measurements);
+  mxZero(&write->gain);
+  mxSetSize(&write->gain, states, measurements);
+  mxZero(&write->innovation);
+  mxSetSize(&write->innovation, measurements, 1);
+  //No steps have been timed yet
+  write->predictCycles = 0;
+  write->updateCycles = 0;
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Predicts the next covariance, P = F*P*F'+Q
+static void esKalmanCovariance(esKalman *filter) {
+  //Shorthand for the size and the elements
+  unsigned int n = filter->covariance.rows;
+  mxElement_t (*p)[MX_SIZE] = filter->covariance.elements;
+  const mxElement_t (*f)[MX_SIZE] = filter->transition.elements;
+  const mxElement_t (*q)[MX_SIZE] = filter->processNoise.elements;
+  const mxElement_t (*fp)[MX_SIZE] = filter->product.elements;
+
+  //Find F*P in the workspace
+  mxMultiply_noalias(&filter->product, &filter->transition, &filter->covariance);
+  //The result is symmetric, so only find the lower triangle (from the lower triangle of Q), then mirror it
+  for (unsigned int i=0; i<n; i++) {
+    for (unsigned int j=0; j<=i; j++) {
+      mxElement_t sum = q[i][j];
+      for (unsigned int k=0; k<n; k++) {sum += fp[i][k]*f[j][k];}
+      p[i][j] = sum;
+      p[j][i] = sum;
+    }
+  }
+}
+
+//Predicts the next state, x = F*x and P = F*P*F'+Q
+void esKalmanPredict(esKalman *filter) {
+  //Start timing
+  unsigned long start = ES_CYCLES();
+
+  //Shorthand for the size and the elements
+  unsigned int n = filter->state.rows;
+  const mxElement_t (*f)[MX_SIZE] = filter->transition.elements;
+  //Find F*x in the first column of the workspace, then copy it over the state
+  for (unsigned int i=0; i<n; i++) {
+    mxElement_t sum = 0;
+    for (unsigned int k=0; k<n; k++) {sum += f[i][k]*filter->state.elements[k][0];}
+    filter->product.elements[i][0] = sum;
+  }
+  for (unsigned int i=0; i<n; i++) {filter->state.elements[i][0] = filter->product.elements[i][0];}
+  //Predict the covariance
+  esKalmanCovariance(filter);
+
+  //Finish timing
+  filter->predictCycles = (unsigned long)(ES_CYCLES()-start);
+}
+
+//Predicts the next covariance only, for an extended filter
+void esKalmanPredict_covariance(esKalman *filter) {
+  //Start timing
+  unsigned long start = ES_CYCLES();
+  //Predict the covariance
+  esKalmanCovariance(filter);
+  //Finish timing
+  filter->predictCycles = (unsigned long)(ES_CYCLES()-start);
+}
+
+//Corrects the state with the innovation already in the filter
+static bool esKalmanCorrect(esKalman *filter) {
+  //Shorthand for the sizes and the elements
+  unsigned int n = filter->covariance.rows;
+  unsigned int m = filter->observation.rows;
+  mxElement_t (*p)[MX_SIZE] = filter->covariance.elements;
+  const mxElement_t (*h)[MX_SIZE] = filter->observation.elements;
+  const mxElement_t (*r)[MX_SIZE] = filter->measurementNoise.elements;
+  mxElement_t (*ph)[MX_SIZE] = filter->crossCovariance.elements;
+  mxElement_t (*s)[MX_SIZE] = filter->innovationCovariance.elements;
+  mxElement_t (*k)[MX_SIZE] = filter->gain.elements;
+
+  /* Cross covariance P*H', and innovation covariance S = H*P*H'+R (symmetric, so only half is found) */
+  for (unsigned int i=0; i<n; i++) {
+    for (unsigned int j=0; j<m; j++) {
+      mxElement_t sum = 0;
+      for (unsigned int c=0; c<n; c++) {sum += p[i][c]*h[j][c];}
+      ph[i][j] = sum;
+    }
+  }
+  for (unsigned int i=0; i<m; i++) {
+    for (unsigned int j=0; j<=i; j++) {
+      mxElement_t sum = r[i][j];
+      for (unsigned int c=0; c<n; c++) {sum += h[i][c]*ph[c][j];}
+      s[i][j] = sum;
+      s[j][i] = sum;
+    }
+  }
+  //Decompose S = L*L' in place (if it fails, the state and covariance haven't been touched)
+  if (!mxCholesky(&filter->innovationCovariance, &filter->innovationCovariance)) {return false;}
+
+  /* Gain K = P*H'*S⁻¹, found a row at a time by solving S*k = (row of P*H') with L and L' */
+  for (unsigned int i=0; i<n; i++) {
+    //Forward substitution with L
+    for (unsigned int a=0; a<m; a++) {
+      mxElement_t entry = ph[i][a];
+      for (unsigned int b=0; b<a; b++) {entry -= s[a][b]*k[i][b];}
+      k[i][a] = entry/s[a][a];
+    }
+    //Backward substitution with L'
+    for (unsigned int a=m; a-->0;) {
+      mxElement_t entry = k[i][a];
+      for (unsigned int b=a+1; b<m; b++) {entry -= s[b][a]*k[i][b];}
+      k[i][a] = entry/s[a][a];
+    }
+  }
+
+  /* Correct the state, x = x+K*y, and the covariance in place, P = P-K*(P*H')' (only half is found) */
+  for (unsigned int i=0; i<n; i++) {
+    mxElement_t sum = 0;
+    for (unsigned int j=0; j<m; j++) {sum += k[i][j]*filter->innovation.elements[j][0];}
+    filter->state.elements[i][0] += sum;
+  }
+  for (unsigned int i=0; i<n; i++) {
+    for (unsigned int j=0; j<=i; j++) {
+      mxElement_t sum = p[i][j];
+      for (unsigned int c=0; c<m; c++) {sum -= k[i][c]*ph[j][c];}
+      p[i][j] = sum;
+      p[j][i] = sum;
+    }
+  }
+  return true;
+}
+
+//Corrects the state with a measurement
+bool esKalmanUpdate(esKalman *filter, const matrix *measurement) {
+  //If the measurement is the wrong size
+  if ((measurement->rows!=filter->observation.rows)||(measurement->columns!=1)) {return false;}
+  //Start timing
+  unsigned long start = ES_CYCLES();
+
+  //Find the innovation, y = z-H*x
+  for (unsigned int i=0; i<filter->observation.rows; i++) {
+    mxElement_t sum = measurement->elements[i][0];
+    for (unsigned int c=0; c<filter->state.rows; c++) {sum -= filter->observation.elements[i][c]*filter->state.elements[c][0];}
+    filter->innovation.elements[i][0] = sum;
+  }
+  //Correct the state and covariance
+  bool success = esKalmanCorrect(filter);
+
+  //Finish timing
+  filter->updateCycles = (unsigned long)(ES_CYCLES()-start);
+  //Indicate whether the process was successful
+  return success;
+}
+
+//Corrects the state with an innovation, for an extended filter
+bool esKalmanUpdate_innovation(esKalman *filter, const matrix *innovation) {
+  //If the innovation is the wrong size
+  if ((innovation->rows!=filter->observation.rows)||(innovation->columns!=1)) {return false;}
+  //Start timing
+  unsigned long start = ES_CYCLES();
+
+  //Copy the innovation into the filter
+  for (unsigned int i=0; i<innovation->rows; i++) {filter->innovation.elements[i][0] = innovation->elements[i][0];}
+  //Correct the state and covariance
+  bool success = esKalmanCorrect(filter);
+
+  //Finish timing
+  filter->updateCycles = (unsigned long)(ES_CYCLES()-start);
+  //Indicate whether the process was successful
+  return success;
+}
+
+/*================================*/
+/* RECURSIVE LEAST SQUARES ================================*/
+
+//Sets up a recursive least squares estimator, in either form
+static bool esRLSSetup(esRLS *write, int parameters, double forgetting, double initialCovariance, bool squareRoot) {
+  //If an argument is out of range
+  if ((parameters<1)||(parameters>MX_SIZE)||!(forgetting>0)||(forgetting>1)||!(initialCovariance>0)) {return false;}
+
+  //Start with zero parameters
+  mxZero(&write->parameters);
+  mxSetSize(&write->parameters, parameters, 1);
+  //Start with P = initialCovariance*I, and the matching R = I/sqrt(initialCovariance)
+  mxIdentity(&write->covariance, parameters);
+  mxScale(&write->covariance, &write->covariance, initialCovariance);
+  mxIdentity(&write->root, parameters);
+  mxScale(&write->root, &write->root, 1/sqrt(initialCovariance));
+  //Clear the gain, and R*θ (which starts at zero)
+  mxZero(&write->gain);
+  mxSetSize(&write->gain, parameters, 1);
+  mxZero(&write->rootTarget);
+  mxSetSize(&write->rootTarget, parameters, 1);
+  //Set the rest of the members
+  write->forgetting = forgetting;
+  write->error = 0;
+  write->squareRoot = squareRoot;
+  write->updateCycles = 0;
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Sets up a recursive least squares estimator
+bool esRLSInit(esRLS *write, int parameters, double forgetting, double initialCovariance) {
+  return esRLSSetup(write, parameters, forgetting, initialCovariance, false);
+}
+
+//Sets up a recursive least squares estimator in square-root form
+bool esRLSInit_sqrt(esRLS *write, int parameters, double forgetting, double initialCovariance) {
+  return esRLSSetup(write, parameters, forgetting, initialCovariance, true);
+}
+
+//Corrects the parameters with a sample, in the standard form
+static bool esRLSStandard(esRLS *filter, const mxElement_t *phi) {
+  //Shorthand for the size and the elements
+  unsigned int n = filter->parameters.rows;
+  mxElement_t (*p)[MX_SIZE] = filter->covariance.elements;
+  mxElement_t (*k)[MX_SIZE] = filter->gain.elements;
+  double lambda = filter->forgetting;
+
+  //Find P*φ in the gain, and the denominator λ+φ'*P*φ
+  mxElement_t denominator = lambda;
+  for (unsigned int i=0; i<n; i++) {
+    mxElement_t sum = 0;
+    for (unsigned int j=0; j<n; j++) {sum += p[i][j]*phi[j];}
+    k[i][0] = sum;
+    denominator += phi[i]*sum;
+  }
+  //If P has stopped being positive-definite, the sample can't be used
+  if (!(denominator>0)) {return false;}
+
+  /* Correct the parameters, θ = θ+k*e where k = P*φ/(λ+φ'*P*φ), and the covariance in place,
+  P = (P-k*(P*φ)')/λ (only half is found, then mirrored) */
+  for (unsigned int i=0; i<n; i++) {filter->parameters.elements[i][0] += filter->error*k[i][0]/denominator;}
+  for (unsigned int i=0; i<n; i++) {
+    for (unsigned int j=0; j<=i; j++) {
+      mxElement_t entry = (p[i][j]-k[i][0]*k[j][0]/denominator)/lambda;
+      p[i][j] = entry;
+      p[j][i] = entry;
+    }
+  }
+  //Scale the gain down from P*φ
+  for (unsigned int i=0; i<n; i++) {k[i][0] /= denominator;}
+  return true;
+}
+
+//Corrects the parameters with a sample, in the square-root form
+static bool esRLSSquareRoot(esRLS *filter, const mxElement_t *phi, mxElement_t measurement) {
+  //Shorthand for the size and the elements
+  unsigned int n = filter->parameters.rows;
+  mxElement_t (*r)[MX_SIZE] = filter->root.elements;
+  mxElement_t (*z)[MX_SIZE] = filter->rootTarget.elements;
+  mxElement_t scale = sqrt(filter->forgetting);
+
+  //Copy the sample, which is rotated into R and R*θ
+  mxElement_t row[MX_SIZE];
+  for (unsigned int i=0; i<n; i++) {row[i] = phi[i];}
+  mxElement_t y = measurement;
+  /* Forget old samples by scaling by sqrt(λ), then append [φ' y] as a row of [R R*θ] and rotate it back to upper triangular */
+  for (unsigned int i=0; i<n; i++) {
+    //Scale this row
+    for (unsigned int j=i; j<n; j++) {r[i][j] *= scale;}
+    z[i][0] *= scale;
+    //If the sample has nothing left in this column, no rotation is needed
+    if (row[i]==0) {continue;}
+    //Make the Givens rotation that zeroes the sample's entry in this column
+    mxElement_t length = sqrt(r[i][i]*r[i][i]+row[i]*row[i]);
+    mxElement_t cosine = r[i][i]/length;
+    mxElement_t sine = row[i]/length;
+    r[i][i] = length;
+    row[i] = 0;
+    //Rotate the rest of the row, and R*θ
+    for (unsigned int j=i+1; j<n; j++) {
+      mxElement_t top = r[i][j];
+      r[i][j] = cosine*top+sine*row[j];
+      row[j] = cosine*row[j]-sine*top;
+    }
+    mxElement_t top = z[i][0];
+    z[i][0] = cosine*top+sine*y;
+    y = cosine*y-sine*top;
+  }
+
+  //Solve R*θ = (R*θ) by backward substitution (R's diagonal stays positive, since it starts positive and only grows or is scaled)
+  for (unsigned int i=n; i-->0;) {
+    mxElement_t entry = z[i][0];
+    for (unsigned int j=i+1; j<n; j++) {entry -= r[i][j]*filter->parameters.elements[j][0];}
+    filter->parameters.elements[i][0] = entry/r[i][i];
+  }
+  return true;
+}
+
+//Corrects the parameters with a sample
+bool esRLSUpdate(esRLS *filter, const matrix *regressor, mxElement_t measurement) {
+  //If the regressor is the wrong size
+  if ((regressor->rows!=filter->parameters.rows)||(regressor->columns!=1)) {return false;}
+  //Start timing
+  unsigned long start = ES_CYCLES();
+
+  //Gather the regressor into a vector
+  mxElement_t phi[MX_SIZE];
+  for (unsigned int i=0; i<regressor->rows; i++) {phi[i] = regressor->elements[i][0];}
+  //Find the prediction error, from before the update
+  filter->error = measurement-esRLSPredict(filter, regressor);
+  //Correct the parameters, in the estimator's form
+  bool success = filter->squareRoot? esRLSSquareRoot(filter, phi, measurement):esRLSStandard(filter, phi);
+
+  //Finish timing
+  filter->updateCycles = (unsigned long)(ES_CYCLES()-start);
+  //Indicate whether the process was successful
+  return success;
+}
+
+//Returns the predicted measurement for a regressor
+mxElement_t esRLSPredict(const esRLS *filter, const matrix *regressor) {
+  //If the regressor is the wrong size
+  if ((regressor->rows!=filter->parameters.rows)||(regressor->columns!=1)) {return 0;}
+  //φ'θ
+  mxElement_t sum = 0;
+  for (unsigned int i=0; i<regressor->rows; i++) {sum += regressor->elements[i][0]*filter->parameters.elements[i][0];}
+  return sum;
+}
+
+/*================================*/
@@ -0,0 +1,173 @@
+// Estimators Library, for estimating states from noisy measurements
+// Header file
+// by Neo Vorsatz
+// Last updated: 16 October 2026
+
+//Header guard
+#ifndef ESTIMATORS_H
+#define ESTIMATORS_H
+
+//Includes
+#include <stdbool.h>
+#include "../c-matrices/matrices.h"
+
+//C++ compatibility
+#ifdef __cplusplus
+  extern "C" {
+#endif
+
+/* EDIT WITH MACROS ================================*/
+
+//Define ES_CYCLES() as an expression that reads a cycle counter (such as DWT->CYCCNT on Cortex-M) to measure each step
+#ifndef ES_CYCLES
+  #if defined(__GNUC__)&&(defined(__x86_64__)||defined(__i386__))
+    #define ES_CYCLES() __builtin_ia32_rdtsc()
+  #else
+    #define ES_CYCLES() 0
+  #endif
+#endif
+
+/*================================*/
+/* TYPE DEFINITIONS ================================*/
+
+//Structure for a Kalman filter, with all of its workspace (so a step never copies or creates matrices)
+typedef struct {
+  matrix state; //state estimate x (states by 1)
+  matrix covariance; //covariance of the state estimate P (states by states), kept symmetric
+  matrix transition; //state transition F (states by states), or its Jacobian for an extended filter
+  matrix processNoise; //covariance of the process noise Q (states by states)
+  matrix observation; //observation H (measurements by states), or its Jacobian for an extended filter
+  matrix measurementNoise; //covariance of the measurement noise R (measurements by measurements)
+  matrix product; //workspace for F*P
+  matrix crossCovariance; //workspace for P*H' (states by measurements)
+  matrix innovationCovariance; //workspace for S = H*P*H'+R, and then its Cholesky decomposition
+  matrix gain; //Kalman gain K (states by measurements) from the last update
+  matrix innovation; //innovation y (measurements by 1) from the last update
+  unsigned long predictCycles; //cycles taken by the last predict (see ES_CYCLES)
+  unsigned long updateCycles; //cycles taken by the last update (see ES_CYCLES)
+} esKalman;
+
+//Structure for a recursive least squares estimator, fitting y = φ'θ one sample at a time.
+//The standard form keeps the covariance P, and the square-root form keeps an upper triangular R with R'R = P⁻¹ instead
+typedef struct {
+  matrix parameters; //parameter estimate θ (parameters by 1)
+  matrix covariance; //covariance of the parameters P (parameters by parameters), kept symmetric, for the standard form
+  matrix gain; //gain k (parameters by 1) from the last update, for the standard form
+  matrix root; //upper triangular square root R of the information matrix P⁻¹, for the square-root form
+  matrix rootTarget; //R*θ (parameters by 1), for the square-root form
+  double forgetting; //forgetting factor λ (1 remembers every sample equally, smaller values forget old samples faster)
+  mxElement_t error; //prediction error y-φ'θ of the last sample, from before the update
+  bool squareRoot; //whether the square-root form is used
+  unsigned long updateCycles; //cycles taken by the last update (see ES_CYCLES)
+} esRLS;
+
+/*================================*/
+/* KALMAN FILTERS ================================*/
+
+/**
+ * @brief Sets up a Kalman filter, with a zero state, identity covariance, identity transition,
+ * zero process noise, zero observation and identity measurement noise
+ * 
+ * @param write A pointer to the Kalman filter
+ * @param states The number of states
+ * @param measurements The number of measurements
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if either size is 0 or bigger than MX_SIZE
+ */
+bool esKalmanInit(esKalman *write, int states, int measurements);
+
+/**
+ * @brief Predicts the next state, x = F*x and P = F*P*F'+Q
+ * 
+ * @param filter A pointer to the Kalman filter
+ */
+void esKalmanPredict(esKalman *filter);
+
+/**
+ * @brief Predicts the next covariance only, P = F*P*F'+Q, for an extended filter
+ * (where the state was already predicted with the non-linear model, and F is its Jacobian)
+ * 
+ * @param filter A pointer to the Kalman filter
+ */
+void esKalmanPredict_covariance(esKalman *filter);
+
+/**
+ * @brief Corrects the state with a measurement z, using the innovation y = z-H*x
+ * 
+ * The gain is found with a Cholesky solve (instead of an inverse), and only half of the symmetric covariance is computed
+ * 
+ * @param filter A pointer to the Kalman filter
+ * @param measurement A pointer to the measurement vector z (measurements by 1)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the sizes are wrong
+ * or H*P*H'+R is not positive-definite (in which case the state and covariance are left unchanged)
+ */
+bool esKalmanUpdate(esKalman *filter, const matrix *measurement);
+
+/**
+ * @brief Corrects the state with an innovation, for an extended filter
+ * (where the innovation z-h(x) was found with the non-linear model, and H is its Jacobian)
+ * 
+ * @param filter A pointer to the Kalman filter
+ * @param innovation A pointer to the innovation vector y (measurements by 1)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the sizes are wrong
+ * or H*P*H'+R is not positive-definite (in which case the state and covariance are left unchanged)
+ */
+bool esKalmanUpdate_innovation(esKalman *filter, const matrix *innovation);
+
+/*================================*/
+/* RECURSIVE LEAST SQUARES ================================*/
+
+/**
+ * @brief Sets up a recursive least squares estimator, with zero parameters and covariance P = initialCovariance*I
+ * 
+ * @param write A pointer to the estimator
+ * @param parameters The number of parameters
+ * @param forgetting The forgetting factor λ, between 0 (exclusive) and 1 (inclusive)
+ * @param initialCovariance The initial variance of each parameter (large values trust the first samples more)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if an argument is out of range
+ */
+bool esRLSInit(esRLS *write, int parameters, double forgetting, double initialCovariance);
+
+/**
+ * @brief Sets up a recursive least squares estimator in square-root form, which updates R with Givens rotations
+ * (like a QR decomposition) instead of updating P, so it stays positive-definite even with float elements
+ * 
+ * @param write A pointer to the estimator
+ * @param parameters The number of parameters
+ * @param forgetting The forgetting factor λ, between 0 (exclusive) and 1 (inclusive)
+ * @param initialCovariance The initial variance of each parameter (large values trust the first samples more)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if an argument is out of range
+ */
+bool esRLSInit_sqrt(esRLS *write, int parameters, double forgetting, double initialCovariance);
+
+/**
+ * @brief Corrects the parameters with a sample, in O(n²) however many samples there have been
+ * 
+ * @param filter A pointer to the estimator
+ * @param regressor A pointer to the regressor vector φ (parameters by 1)
+ * @param measurement The measurement y
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the regressor is the wrong size
+ * or the covariance has stopped being positive-definite (in which case the estimator is left unchanged)
+ */
+bool esRLSUpdate(esRLS *filter, const matrix *regressor, mxElement_t measurement);
+
+/**
+ * @param filter A pointer to the estimator
+ * @param regressor A pointer to the regressor vector φ (parameters by 1)
+ * 
+ * @return The predicted measurement φ'θ, otherwise returns 0 if the regressor is the wrong size
+ */
+mxElement_t esRLSPredict(const esRLS *filter, const matrix *regressor);
+
+/*================================*/
+
+#ifdef __cplusplus
+  }
+#endif
+
+#endif
@@ -0,0 +1,57 @@
+// Programme to test the estimators library; Estimators
+// by Neo Vorsatz
+// Last updated: 16 October 2026
+
+#include <stdio.h>
+
+//Test was done with a maximum matrix size of 4 by 4, and the elements as type "double"
+#define MX_SIZE 4
+#define MX_ELEMENT double
+#include "../c-matrices/matrices.c"
+#include "estimators.c"
+
+int main() {
+  /* A constant-velocity model, with position and velocity states, and a position measurement */
+  esKalman filter;
+  esKalmanInit(&filter, 2, 1);
+  mxWriteElement(&filter.transition, 0, 1, 1);
+  mxWriteElement(&filter.observation, 0, 0, 1);
+
+  //Testing the prediction
+  esKalmanPredict(&filter);
+  printf("Predicted covariance: %f, %f, %f, %f | expected: 2.000000, 1.000000, 1.000000, 1.000000\n", filter.covariance.elements[0][0], filter.covariance.elements[0][1], filter.covariance.elements[1][0], filter.covariance.elements[1][1]);
+
+  //Testing the update, with a measurement of 3
+  matrix measurement;
+  mxSetSize(&measurement, 1, 1);
+  mxWriteElement(&measurement, 0, 0, 3);
+  esKalmanUpdate(&filter, &measurement);
+  printf("Gain: %f, %f | expected: 0.666667, 0.333333\n", filter.gain.elements[0][0], filter.gain.elements[1][0]);
+  printf("Updated state: %f, %f | expected: 2.000000, 1.000000\n", filter.state.elements[0][0], filter.state.elements[1][0]);
+  printf("Updated covariance: %f, %f, %f, %f | expected: 0.666667, 0.333333, 0.333333, 0.666667\n", filter.covariance.elements[0][0], filter.covariance.elements[0][1], filter.covariance.elements[1][0], filter.covariance.elements[1][1]);
+  printf("Cycles per predict and update: %lu, %lu\n", filter.predictCycles, filter.updateCycles);
+
+  /* Fitting y = 1+2x from samples, in both forms */
+  esRLS fit;
+  esRLS fitRoot;
+  esRLSInit(&fit, 2, 1, 1e6);
+  esRLSInit_sqrt(&fitRoot, 2, 1, 1e6);
+  matrix regressor;
+  mxSetSize(&regressor, 2, 1);
+  mxWriteElement(&regressor, 0, 0, 1);
+  for (int x=0; x<5; x++) {
+    mxWriteElement(&regressor, 1, 0, x);
+    esRLSUpdate(&fit, &regressor, 1+2*x);
+    esRLSUpdate(&fitRoot, &regressor, 1+2*x);
+  }
+
+  //Testing the parameters and a prediction
+  printf("RLS parameters: %.3f, %.3f | expected: 1.000, 2.000\n", fit.parameters.elements[0][0], fit.parameters.elements[1][0]);
+  printf("Square-root RLS parameters: %.3f, %.3f | expected: 1.000, 2.000\n", fitRoot.parameters.elements[0][0], fitRoot.parameters.elements[1][0]);
+  mxWriteElement(&regressor, 1, 0, 10);
+  printf("RLS prediction at x=10: %.3f | expected: 21.000\n", esRLSPredict(&fit, &regressor));
+  printf("Cycles per RLS update: %lu\n", fit.updateCycles);
+
+  //Finished
+  return 0;
+}
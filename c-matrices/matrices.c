@@ -1,12 +1,44 @@
 // Matrices Library, for matrix operations
 // Implementation file
 // by Neo Vorsatz
-// Last updated: 27 December 2025
+// Last updated: 16 October 2026
 
 #include "matrices.h"
+#include <math.h>
+#include <float.h>
 
 #define __FAIL 0
 #define __INF_SOLUTIONS 1
+#define __ABS(x) (((x)<0)? -(x):(x))
+#ifdef MX_SVD_TOLERANCE
+  #define __SVD_TOLERANCE(rows, columns) (MX_SVD_TOLERANCE)
+#else
+  #define __SVD_TOLERANCE(rows, columns) ((((rows)>(columns))? (rows):(columns))*((sizeof(mxElement_t)<sizeof(double))? FLT_EPSILON:DBL_EPSILON))
+#endif
+
+/* SIMD SUPPORT ================================*/
+
+//x86: SSE2 is always available on 64-bit, and AVX2 is detected at runtime (or enabled by the compiler)
+#if !defined(MX_NO_SIMD) && (defined(__x86_64__)||defined(_M_X64)||defined(__SSE2__))
+  #include <immintrin.h>
+  #define __MX_SSE2
+  #if defined(__GNUC__)
+    #define __MX_AVX2
+    #define __MX_AVX2_TARGET __attribute__((target("avx2,fma")))
+  #elif defined(__AVX2__)
+    #define __MX_AVX2
+    #define __MX_AVX2_TARGET
+  #endif
+//ARM: NEON (with doubles) is always available on 64-bit
+#elif !defined(MX_NO_SIMD) && (defined(__aarch64__)||defined(_M_ARM64))
+  #include <arm_neon.h>
+  #define __MX_NEON
+#endif
+
+//Whether the elements are doubles (the SIMD kernels only handle doubles)
+#define __MX_DOUBLE ((sizeof(mxElement_t)==sizeof(double))&&((mxElement_t)0.5!=0))
+
+/*================================*/
 
 /* WRITING ================================*/
 
@@ -315,425 +347,1292 @@ mxElement_t mxReadElement(const matrix *read, int row, int column) {
 /*================================*/
 /* OPERATIONS ================================*/
 
-//Checks if two matrices are equal
-bool mxEqual(const matrix *read1, const matrix *read2) {
-  //If the sizes are different
-  if (!((read1->rows==read2->rows)&&(read1->columns==read2->columns))) {
-    //Then the matrices aren't equal
-    return false;
+//Solves L*U*x = b in place, where the array holds the permuted b and is overwritten with x
+static void mxLUSubstitute(const mxLUFactor *factor, mxElement_t *x) {
+  //Shorthand for the size and the elements
+  unsigned int n = factor->lu.rows;
+  const mxElement_t (*a)[MX_SIZE] = factor->lu.elements;
+  //Forward substitution with the unit lower triangle
+  for (unsigned int r=1; r<n; r++) {
+    for (unsigned int c=0; c<r; c++) {x[r] -= a[r][c]*x[c];}
   }
-  //For each row
-  for (unsigned int r=0; r<read1->rows; r++) {
-    //For each column
-    for (unsigned int c=0; c<read1->columns; c++) {
-      //If the entries are not the same
-      if (read1->elements[r][c]!=read2->elements[r][c]) {
-        //Then the matrices aren't equal
-        return false;
-      }
-    }
+  //Backward substitution with the upper triangle
+  for (unsigned int r=n; r-->0;) {
+    for (unsigned int c=r+1; c<n; c++) {x[r] -= a[r][c]*x[c];}
+    x[r] /= a[r][r];
   }
-  //If we've reached this step, the matrices are equal
-  return true;
 }
 
-//Empties a matrix
-void mxZero(matrix *write) {
-  //Set the sizze to 0
-  write->rows = 0;
-  write->columns = 0;
-  //For each row
-  for (unsigned int r=0; r<MX_SIZE; r++) {
-    //For each column
-    for (unsigned int c=0; c<MX_SIZE; c++) {
-      //Replace the entry with 0
-      write->elements[r][c] = 0;
-    }
-  }
-}
+/* The following SIMD kernels work on rows of doubles, and return how many elements they handled
+(the callers finish any remaining elements one at a time) */
 
-//Turns a matrix into the identity matrix with a particular size
-bool mxIdentity(matrix *write, int size) {
-  //If the size is too large
-  if (size>MX_SIZE) {return false;}
+#ifdef __MX_AVX2
+//Adds two rows, 4 elements at a time
+__MX_AVX2_TARGET static unsigned int mxAddAVX2(double *write, const double *read1, const double *read2, unsigned int length) {
+  unsigned int c = 0;
+  for (; c+4<=length; c+=4) {_mm256_storeu_pd(write+c, _mm256_add_pd(_mm256_loadu_pd(read1+c), _mm256_loadu_pd(read2+c)));}
+  return c;
+}
 
-  //Set the size
-  write->rows = size;
-  write->columns = size;
-  //For each row
-  for (unsigned int r=0; r<size; r++) {
-    //For each column
-    for (unsigned int c=0; c<size; c++) {
-      //If this entry is on the diagonal
-      if (r==c) {
-        //Replace the entry with 1
-        write->elements[r][c] = 1;
-      } else {
-        //Replace the entry with 0
-        write->elements[r][c] = 0;
-      }
-    }
-  }
+//Scales a row, 4 elements at a time
+__MX_AVX2_TARGET static unsigned int mxScaleAVX2(double *write, const double *read, double factor, unsigned int length) {
+  __m256d f = _mm256_set1_pd(factor);
+  unsigned int c = 0;
+  for (; c+4<=length; c+=4) {_mm256_storeu_pd(write+c, _mm256_mul_pd(_mm256_loadu_pd(read+c), f));}
+  return c;
+}
 
-  //Indicate that the process was successful
-  return true;
+//Adds a scaled row to Write, 4 elements at a time
+__MX_AVX2_TARGET static unsigned int mxAxpyAVX2(double *write, double scalar, const double *read, unsigned int length) {
+  __m256d f = _mm256_set1_pd(scalar);
+  unsigned int c = 0;
+  for (; c+4<=length; c+=4) {_mm256_storeu_pd(write+c, _mm256_fmadd_pd(f, _mm256_loadu_pd(read+c), _mm256_loadu_pd(write+c)));}
+  return c;
 }
 
-//Adds the second matrix to the first
-bool mxAdd(matrix *write, const matrix *read1, const matrix *read2) {
-  //If the matrices can't be added
-  if (!( (read1->rows==read2->rows)&&(read1->columns==read2->columns) )) {return false;}
+//Adds the same multiple of a row to each of two rows, in one pass, 4 elements at a time
+__MX_AVX2_TARGET static unsigned int mxAxpy2AVX2(double *write1, const double *read1, double *write2, const double *read2, double scalar, unsigned int length) {
+  __m256d f = _mm256_set1_pd(scalar);
+  unsigned int c = 0;
+  for (; c+4<=length; c+=4) {
+    _mm256_storeu_pd(write1+c, _mm256_fmadd_pd(f, _mm256_loadu_pd(read1+c), _mm256_loadu_pd(write1+c)));
+    _mm256_storeu_pd(write2+c, _mm256_fmadd_pd(f, _mm256_loadu_pd(read2+c), _mm256_loadu_pd(write2+c)));
+  }
+  return c;
+}
 
-  //Temporarily storing the Read matrices
-  matrix m1;
-  mxCopy(&m1, read1);
-  matrix m2;
-  mxCopy(&m2, read2);
+//Multiplies a packed panel of 4 rows by a packed panel of 8 columns, into a tile
+__MX_AVX2_TARGET static void mxTileAVX2(double *tile, const double *panel1, const double *panel2, unsigned int inner) {
+  //Two registers per row of the tile
+  __m256d s00 = _mm256_setzero_pd(), s01 = _mm256_setzero_pd();
+  __m256d s10 = _mm256_setzero_pd(), s11 = _mm256_setzero_pd();
+  __m256d s20 = _mm256_setzero_pd(), s21 = _mm256_setzero_pd();
+  __m256d s30 = _mm256_setzero_pd(), s31 = _mm256_setzero_pd();
+  //For each term
+  for (unsigned int i=0; i<inner; i++) {
+    __m256d b0 = _mm256_loadu_pd(panel2+i*8);
+    __m256d b1 = _mm256_loadu_pd(panel2+i*8+4);
+    __m256d a;
+    a = _mm256_broadcast_sd(panel1+i*4+0); s00 = _mm256_fmadd_pd(a, b0, s00); s01 = _mm256_fmadd_pd(a, b1, s01);
+    a = _mm256_broadcast_sd(panel1+i*4+1); s10 = _mm256_fmadd_pd(a, b0, s10); s11 = _mm256_fmadd_pd(a, b1, s11);
+    a = _mm256_broadcast_sd(panel1+i*4+2); s20 = _mm256_fmadd_pd(a, b0, s20); s21 = _mm256_fmadd_pd(a, b1, s21);
+    a = _mm256_broadcast_sd(panel1+i*4+3); s30 = _mm256_fmadd_pd(a, b0, s30); s31 = _mm256_fmadd_pd(a, b1, s31);
+  }
+  _mm256_storeu_pd(tile+0, s00); _mm256_storeu_pd(tile+4, s01);
+  _mm256_storeu_pd(tile+8, s10); _mm256_storeu_pd(tile+12, s11);
+  _mm256_storeu_pd(tile+16, s20); _mm256_storeu_pd(tile+20, s21);
+  _mm256_storeu_pd(tile+24, s30); _mm256_storeu_pd(tile+28, s31);
+}
+#endif
 
-  //Setting the size
-  write->rows = m1.rows;
-  write->columns = m1.columns;
-  //For each row
-  for (unsigned int r=0; r<m1.rows; r++) {
-    //For each column
-    for (unsigned int c=0; c<m1.columns; c++) {
-      //Write the sum of the two entries
-      write->elements[r][c] = m1.elements[r][c] + m2.elements[r][c];
+#ifdef __MX_SSE2
+//Multiplies a packed panel of 4 rows by a packed panel of 8 columns, into a tile
+static void mxTileSSE2(double *tile, const double *panel1, const double *panel2, unsigned int inner) {
+  //The tile is done in two halves of 4 columns, so the sums fit in the registers
+  for (unsigned int h=0; h<8; h+=4) {
+    //Two registers per row of the half-tile
+    __m128d s00 = _mm_setzero_pd(), s01 = _mm_setzero_pd();
+    __m128d s10 = _mm_setzero_pd(), s11 = _mm_setzero_pd();
+    __m128d s20 = _mm_setzero_pd(), s21 = _mm_setzero_pd();
+    __m128d s30 = _mm_setzero_pd(), s31 = _mm_setzero_pd();
+    //For each term
+    for (unsigned int i=0; i<inner; i++) {
+      __m128d b0 = _mm_loadu_pd(panel2+i*8+h);
+      __m128d b1 = _mm_loadu_pd(panel2+i*8+h+2);
+      __m128d a;
+      a = _mm_set1_pd(panel1[i*4+0]); s00 = _mm_add_pd(s00, _mm_mul_pd(a, b0)); s01 = _mm_add_pd(s01, _mm_mul_pd(a, b1));
+      a = _mm_set1_pd(panel1[i*4+1]); s10 = _mm_add_pd(s10, _mm_mul_pd(a, b0)); s11 = _mm_add_pd(s11, _mm_mul_pd(a, b1));
+      a = _mm_set1_pd(panel1[i*4+2]); s20 = _mm_add_pd(s20, _mm_mul_pd(a, b0)); s21 = _mm_add_pd(s21, _mm_mul_pd(a, b1));
+      a = _mm_set1_pd(panel1[i*4+3]); s30 = _mm_add_pd(s30, _mm_mul_pd(a, b0)); s31 = _mm_add_pd(s31, _mm_mul_pd(a, b1));
     }
+    _mm_storeu_pd(tile+h, s00); _mm_storeu_pd(tile+h+2, s01);
+    _mm_storeu_pd(tile+8+h, s10); _mm_storeu_pd(tile+8+h+2, s11);
+    _mm_storeu_pd(tile+16+h, s20); _mm_storeu_pd(tile+16+h+2, s21);
+    _mm_storeu_pd(tile+24+h, s30); _mm_storeu_pd(tile+24+h+2, s31);
   }
-
-  //Indicate that the process was successful
-  return true;
 }
+#endif
 
-//Scales/Multiplies the given matrix by a factor
-void mxScale(matrix *write, const matrix *read, double factor) {
-  //Setting the size
-  write->rows = read->rows;
-  write->columns = read->columns;
-  //For each row
-  for (unsigned int r=0; r<read->rows; r++) {
-    //For each column
-    for (unsigned int c=0; c<read->columns; c++) {
-      write->elements[r][c] = read->elements[r][c] * factor;
+#ifdef __MX_NEON
+//Multiplies a packed panel of 4 rows by a packed panel of 8 columns, into a tile
+static void mxTileNEON(double *tile, const double *panel1, const double *panel2, unsigned int inner) {
+  //Four registers per row of the tile
+  float64x2_t s[4][4];
+  for (unsigned int r=0; r<4; r++) {
+    for (unsigned int c=0; c<4; c++) {s[r][c] = vdupq_n_f64(0);}
+  }
+  //For each term
+  for (unsigned int i=0; i<inner; i++) {
+    float64x2_t b[4];
+    for (unsigned int c=0; c<4; c++) {b[c] = vld1q_f64(panel2+i*8+c*2);}
+    for (unsigned int r=0; r<4; r++) {
+      float64x2_t a = vdupq_n_f64(panel1[i*4+r]);
+      for (unsigned int c=0; c<4; c++) {s[r][c] = vfmaq_f64(s[r][c], a, b[c]);}
     }
   }
+  for (unsigned int r=0; r<4; r++) {
+    for (unsigned int c=0; c<4; c++) {vst1q_f64(tile+r*8+c*2, s[r][c]);}
+  }
 }
+#endif
 
-//Multiplies the matrices
-bool mxMultiply(matrix *write, const matrix *read1, const matrix *read2) {
-  //If the matrices can't be multiplied
-  if (read1->columns!=read2->rows) {return false;}
+//Adds two rows of doubles, using the active SIMD path
+static void mxSimdAdd(double *write, const double *read1, const double *read2, unsigned int length) {
+  unsigned int c = 0;
+  switch (mxSimdPath()) {
+#ifdef __MX_AVX2
+    case MX_SIMD_AVX2: c = mxAddAVX2(write, read1, read2, length); break;
+#endif
+#ifdef __MX_SSE2
+    case MX_SIMD_SSE2: for (; c+2<=length; c+=2) {_mm_storeu_pd(write+c, _mm_add_pd(_mm_loadu_pd(read1+c), _mm_loadu_pd(read2+c)));} break;
+#endif
+#ifdef __MX_NEON
+    case MX_SIMD_NEON: for (; c+2<=length; c+=2) {vst1q_f64(write+c, vaddq_f64(vld1q_f64(read1+c), vld1q_f64(read2+c)));} break;
+#endif
+    default: break;
+  }
+  //Finish the remaining elements one at a time
+  for (; c<length; c++) {write[c] = read1[c] + read2[c];}
+}
+
+//Scales a row of doubles, using the active SIMD path
+static void mxSimdScale(double *write, const double *read, double factor, unsigned int length) {
+  unsigned int c = 0;
+  switch (mxSimdPath()) {
+#ifdef __MX_AVX2
+    case MX_SIMD_AVX2: c = mxScaleAVX2(write, read, factor, length); break;
+#endif
+#ifdef __MX_SSE2
+    case MX_SIMD_SSE2: for (; c+2<=length; c+=2) {_mm_storeu_pd(write+c, _mm_mul_pd(_mm_loadu_pd(read+c), _mm_set1_pd(factor)));} break;
+#endif
+#ifdef __MX_NEON
+    case MX_SIMD_NEON: for (; c+2<=length; c+=2) {vst1q_f64(write+c, vmulq_n_f64(vld1q_f64(read+c), factor));} break;
+#endif
+    default: break;
+  }
+  //Finish the remaining elements one at a time
+  for (; c<length; c++) {write[c] = read[c] * factor;}
+}
 
-  //Temporarily storing the Read matrices
-  matrix m1;
-  mxCopy(&m1, read1);
-  matrix m2;
-  mxCopy(&m2, read2);
+//Adds a scaled row of doubles to Write, using the active SIMD path
+static void mxSimdAxpy(double *write, double scalar, const double *read, unsigned int length) {
+  unsigned int c = 0;
+  switch (mxSimdPath()) {
+#ifdef __MX_AVX2
+    case MX_SIMD_AVX2: c = mxAxpyAVX2(write, scalar, read, length); break;
+#endif
+#ifdef __MX_SSE2
+    case MX_SIMD_SSE2: for (; c+2<=length; c+=2) {_mm_storeu_pd(write+c, _mm_add_pd(_mm_loadu_pd(write+c), _mm_mul_pd(_mm_set1_pd(scalar), _mm_loadu_pd(read+c))));} break;
+#endif
+#ifdef __MX_NEON
+    case MX_SIMD_NEON: for (; c+2<=length; c+=2) {vst1q_f64(write+c, vfmaq_n_f64(vld1q_f64(write+c), vld1q_f64(read+c), scalar));} break;
+#endif
+    default: break;
+  }
+  //Finish the remaining elements one at a time
+  for (; c<length; c++) {write[c] += scalar * read[c];}
+}
 
-  //Setting the size
-  write->rows = m1.rows;
-  write->columns = m2.columns;
-  //For each row
-  for (unsigned int r=0; r<write->rows; r++) {
-    //For each column
-    for (unsigned int c=0; c<write->columns; c++) {
-      //Set the cumulative sum to 0
-      mxElement_t sum = 0;
-      //For each term
-      for (unsigned int i=0; i<m1.columns; i++) {
-        //Increase the sum by the product
-        sum += m1.elements[r][i] * m2.elements[i][c];
+//Adds the same multiple of a row to each of two rows of doubles, in one pass over the columns they share, using the active SIMD path
+static void mxSimdAxpy2(double *write1, const double *read1, unsigned int length1, double *write2, const double *read2, unsigned int length2, double scalar) {
+  //The columns both rows have
+  unsigned int length = (length1<length2)? length1:length2;
+  unsigned int c = 0;
+  switch (mxSimdPath()) {
+#ifdef __MX_AVX2
+    case MX_SIMD_AVX2: c = mxAxpy2AVX2(write1, read1, write2, read2, scalar, length); break;
+#endif
+#ifdef __MX_SSE2
+    case MX_SIMD_SSE2:
+      for (; c+2<=length; c+=2) {
+        _mm_storeu_pd(write1+c, _mm_add_pd(_mm_loadu_pd(write1+c), _mm_mul_pd(_mm_set1_pd(scalar), _mm_loadu_pd(read1+c))));
+        _mm_storeu_pd(write2+c, _mm_add_pd(_mm_loadu_pd(write2+c), _mm_mul_pd(_mm_set1_pd(scalar), _mm_loadu_pd(read2+c))));
       }
-      //Set the entry as the sum
-      write->elements[r][c] = sum;
-    }
+      break;
+#endif
+#ifdef __MX_NEON
+    case MX_SIMD_NEON:
+      for (; c+2<=length; c+=2) {
+        vst1q_f64(write1+c, vfmaq_n_f64(vld1q_f64(write1+c), vld1q_f64(read1+c), scalar));
+        vst1q_f64(write2+c, vfmaq_n_f64(vld1q_f64(write2+c), vld1q_f64(read2+c), scalar));
+      }
+      break;
+#endif
+    default: break;
   }
-
-  //Indicate that the process was successful
-  return true;
+  //Finish the shared columns one at a time, then whichever row is longer
+  for (; c<length; c++) {
+    write1[c] += scalar * read1[c];
+    write2[c] += scalar * read2[c];
+  }
+  if (length1>length) {mxSimdAxpy(write1+length, scalar, read1+length, length1-length);}
+  if (length2>length) {mxSimdAxpy(write2+length, scalar, read2+length, length2-length);}
 }
 
-//Returns the determinant of the given matrix
-mxElement_t mxDeterminant(const matrix *read) {
-  //If it's not a square matrix
-  if (read->rows!=read->columns) {return __FAIL;}
-  //If there is only 1 element, return that element
-  if (read->rows==1) {return read->elements[0][0];}
+//Multiplies a packed panel of 4 rows by a packed panel of 8 columns into a tile of doubles, using the active SIMD path
+static bool mxSimdTile(double *tile, const double *panel1, const double *panel2, unsigned int inner) {
+  switch (mxSimdPath()) {
+#ifdef __MX_AVX2
+    case MX_SIMD_AVX2: mxTileAVX2(tile, panel1, panel2, inner); return true;
+#endif
+#ifdef __MX_SSE2
+    case MX_SIMD_SSE2: mxTileSSE2(tile, panel1, panel2, inner); return true;
+#endif
+#ifdef __MX_NEON
+    case MX_SIMD_NEON: mxTileNEON(tile, panel1, panel2, inner); return true;
+#endif
+    //If there is no SIMD path, the caller must compute the tile
+    default: return false;
+  }
+}
 
-  //Set the determinant to 0 initially
-  mxElement_t determinant = 0;
-  //Set the sign to positive
-  signed int sign = 1;
-  //Get memory for the submatrix
-  matrix submatrix;
+/* The following kernels work on row-major elements, where 'stride' is the number of elements
+between the starts of consecutive rows. They are shared by 'matrix' and 'mxDyn' */
 
-  //For each element in the first row
-  for (unsigned int c=0; c<read->columns; c++) {
-    //Copy the contents to the submatrix
-    mxCopy(&submatrix, read);
-    //Delete the first row of the submatrix
-    mxDeleteRow(&submatrix, 0);
-    //Delete the corresponding column of the submatrix
-    mxDeleteColumn(&submatrix, c);
-
-    //Add the element multiplied by the cofactor to the determinant
-    determinant += (read->elements[0][c])*sign*mxDeterminant(&submatrix);
-    //Change the sign for the next cofactor
-    sign *= -1;
+//Adds two blocks of elements
+static void mxAddKernel(mxElement_t *write, unsigned int writeStride, const mxElement_t *read1, unsigned int read1Stride, const mxElement_t *read2, unsigned int read2Stride, unsigned int rows, unsigned int columns) {
+  //If the elements are doubles, and there is a SIMD path, add row by row with it
+  if (__MX_DOUBLE&&(mxSimdPath()!=MX_SIMD_SCALAR)) {
+    for (unsigned int r=0; r<rows; r++) {mxSimdAdd((double*)write+r*writeStride, (const double*)read1+r*read1Stride, (const double*)read2+r*read2Stride, columns);}
+    return;
   }
 
-  //Return the value of the determinant
-  return determinant;
+  //For each row
+  for (unsigned int r=0; r<rows; r++) {
+    //For each column
+    for (unsigned int c=0; c<columns; c++) {
+      //Write the sum of the two entries
+      write[r*writeStride+c] = read1[r*read1Stride+c] + read2[r*read2Stride+c];
+    }
+  }
 }
 
-//Transposes the given matrix
-void mxTranspose(matrix *write, const matrix *read) {
-  //Temporarily storing the Read matrix
-  matrix m;
-  mxCopy(&m, read);
+//Scales a block of elements by a factor
+static void mxScaleKernel(mxElement_t *write, unsigned int writeStride, const mxElement_t *read, unsigned int readStride, unsigned int rows, unsigned int columns, double factor) {
+  //If the elements are doubles, and there is a SIMD path, scale row by row with it
+  if (__MX_DOUBLE&&(mxSimdPath()!=MX_SIMD_SCALAR)) {
+    for (unsigned int r=0; r<rows; r++) {mxSimdScale((double*)write+r*writeStride, (const double*)read+r*readStride, factor, columns);}
+    return;
+  }
 
-  //Swap the number of rows and columns
-  write->rows = m.columns;
-  write->columns = m.rows;
   //For each row
-  for (unsigned int r=0; r<MX_SIZE; r++) {
+  for (unsigned int r=0; r<rows; r++) {
     //For each column
-    for (unsigned int c=0; c<MX_SIZE; c++) {
-      //Copy the element into the transposed-position
-      write->elements[c][r] = m.elements[r][c];
+    for (unsigned int c=0; c<columns; c++) {
+      write[r*writeStride+c] = read[r*readStride+c] * factor;
     }
   }
 }
 
-//Gets the adjoint of the given matrix
-bool mxAdjoint(matrix *write, const matrix *read) {
-  //If it's not a square matrix
-  if (read->rows!=read->columns) {return false;}
+//Register tile size of the multiplication micro-kernel (rows by columns)
+#define __MR 4
+#define __NR 8
 
-  //Temporarily storing the Read matrix
-  matrix m;
-  mxCopy(&m, read);
+//Multiplies a packed panel of __MR rows by a packed panel of __NR columns, accumulating into a tile of Write
+static void mxGemmMicroKernel(mxElement_t *write, unsigned int writeStride, const mxElement_t *panel1, const mxElement_t *panel2, unsigned int inner, unsigned int rows, unsigned int columns) {
+  //Accumulators for the tile, which the compiler can keep in registers
+  mxElement_t sum[__MR][__NR] = {{0}};
+  //If the elements are doubles, try computing the tile with the SIMD path
+  if (!(__MX_DOUBLE&&mxSimdTile((double*)sum[0], (const double*)panel1, (const double*)panel2, inner))) {
+    //For each term
+    for (unsigned int i=0; i<inner; i++) {
+      //For each row of the tile
+      for (unsigned int r=0; r<__MR; r++) {
+        //For each column of the tile
+        for (unsigned int c=0; c<__NR; c++) {
+          //Increase the sum by the product
+          sum[r][c] += panel1[i*__MR+r] * panel2[i*__NR+c];
+        }
+      }
+    }
+  }
+  //Add the tile to Write (only the part that's inside the matrix)
+  for (unsigned int r=0; r<rows; r++) {
+    for (unsigned int c=0; c<columns; c++) {write[r*writeStride+c] += sum[r][c];}
+  }
+}
 
-  //Setting the size
-  write->rows = m.rows;
-  write->columns = m.columns;
+//Multiplies two blocks of elements, in cache-sized blocks with packed panels (Write = alpha*Read1*Read2 + Write).
+//'pack' holds MX_GEMM_PACK elements
+static void mxGemmBlocked(mxElement_t *write, unsigned int writeStride, double alpha, const mxElement_t *read1, unsigned int read1Stride, const mxElement_t *read2, unsigned int read2Stride, unsigned int rows, unsigned int inner, unsigned int columns, mxElement_t *pack) {
+  //Packed block of Read1, stored as panels of __MR rows (each panel is stored term by term)
+  mxElement_t *packed1 = pack;
+  //Packed panel of Read2, with __NR columns (stored term by term), after the block
+  mxElement_t *packed2 = pack+((MX_GEMM_MC+__MR-1)/__MR)*__MR*MX_GEMM_KC;
 
-  //Get memory for the submatrix
-  matrix submatrix;
-  //For each row
-  for (unsigned int r=0; r<m.rows; r++) {
-    //For each column
-    for (unsigned int c=0; c<m.columns; c++) {
-      //Copy the contents to the submatrix
-      mxCopy(&submatrix, &m);
-      //Delete the corresponding row of the submatrix
-      mxDeleteRow(&submatrix, r);
-      //Delete the corresponding column of the submatrix
-      mxDeleteColumn(&submatrix, c);
+  //For each block of terms
+  for (unsigned int k0=0; k0<inner; k0+=MX_GEMM_KC) {
+    unsigned int kc = (inner-k0<MX_GEMM_KC)? inner-k0:MX_GEMM_KC;
+    //For each block of rows
+    for (unsigned int r0=0; r0<rows; r0+=MX_GEMM_MC) {
+      unsigned int mc = (rows-r0<MX_GEMM_MC)? rows-r0:MX_GEMM_MC;
 
-      //Set the transposed element of the adjoint matrix
-      write->elements[c][r] = (((r+c)%2)? -1:1)*mxDeterminant(&submatrix);
+      /* Pack (and scale) the block of Read1, padding the last panel with zeros */
+      //For each panel of rows
+      for (unsigned int pr=0; pr<mc; pr+=__MR) {
+        mxElement_t *panel = packed1+pr*kc;
+        //For each term
+        for (unsigned int i=0; i<kc; i++) {
+          //For each row of the panel
+          for (unsigned int r=0; r<__MR; r++) {
+            panel[i*__MR+r] = (pr+r<mc)? read1[(r0+pr+r)*read1Stride+k0+i]*alpha:0;
+          }
+        }
+      }
+
+      //For each panel of columns
+      for (unsigned int c0=0; c0<columns; c0+=__NR) {
+        unsigned int nc = (columns-c0<__NR)? columns-c0:__NR;
+        /* Pack the panel of Read2, padding with zeros */
+        //For each term
+        for (unsigned int i=0; i<kc; i++) {
+          //For each column of the panel
+          for (unsigned int c=0; c<__NR; c++) {
+            packed2[i*__NR+c] = (c<nc)? read2[(k0+i)*read2Stride+c0+c]:0;
+          }
+        }
+        //For each panel of rows, multiply the panels into a tile of Write
+        for (unsigned int pr=0; pr<mc; pr+=__MR) {
+          unsigned int mr = (mc-pr<__MR)? mc-pr:__MR;
+          mxGemmMicroKernel(write+(r0+pr)*writeStride+c0, writeStride, packed1+pr*kc, packed2, kc, mr, nc);
+        }
+      }
     }
   }
+}
 
-  //Indicate that the process was successful
-  return true;
+//Takes space from an arena to pack large multiplications into, otherwise returns null if there's no arena or not enough room
+//(take it after the rest of the workspace, so it's only used if the required space fits)
+static mxElement_t *mxGemmPack(mxArena *work) {
+  if (work==0) {return 0;}
+  return mxArenaAlloc(work, MX_GEMM_PACK);
 }
 
-//Inverts the given matrix
-bool mxInverse(matrix *write, const matrix *read) {
-  //If it's not a square matrix
-  if (read->rows!=read->columns) {return false;}
-  //Getting the determinant
-  mxElement_t det = mxDeterminant(read);
-  //If the determinant is zero, the inverse doesn't exist
-  if (det==0) {return false;}
+/* The fixed-size functions pass __FIXED_PACK as their pack, which asks for one on the stack only when a multiplication is
+large enough to be blocked (and only exists when MX_SIZE is big enough for that). The stack space is taken in its own function,
+so smaller multiplications don't reserve it */
+#if MX_SIZE*MX_SIZE*MX_SIZE>MX_GEMM_THRESHOLD
+  #if defined(__GNUC__)
+    #define __MX_NOINLINE __attribute__((noinline))
+  #elif defined(_MSC_VER)
+    #define __MX_NOINLINE __declspec(noinline)
+  #else
+    #define __MX_NOINLINE
+  #endif
 
-  //Set Write to the adjoint
-  mxAdjoint(write, read);
-  //Scale Write by dividing by the determinant
-  mxScale(write, write, 1/det);
+//Marks that a pack should be taken from the stack (its address is only compared, never written)
+static mxElement_t mxFixedPack[1];
+  #define __FIXED_PACK mxFixedPack
 
-  //Indicate that the process was successful
-  return true;
+//Multiplies two blocks of elements in cache-sized blocks, packed into (uninitialised) space on the stack
+__MX_NOINLINE static void mxGemmBlockedStack(mxElement_t *write, unsigned int writeStride, double alpha, const mxElement_t *read1, unsigned int read1Stride, const mxElement_t *read2, unsigned int read2Stride, unsigned int rows, unsigned int inner, unsigned int columns) {
+  mxElement_t pack[MX_GEMM_PACK];
+  mxGemmBlocked(write, writeStride, alpha, read1, read1Stride, read2, read2Stride, rows, inner, columns, pack);
 }
+#else
+  #define __FIXED_PACK 0
+#endif
 
-//Solves for a particular element within a particular vector using Cramer's rule
-mxElement_t mxSolveCramer(const matrix *transform, const matrix *result, int vector, int index) {
-  //If it's not a square matrix
-  if (transform->rows!=transform->columns) {return __FAIL;}
-  //If the vector number is out of bounds
-  if (vector>=result->columns) {return __FAIL;}
-  //If the index is out of bounds
-  if (index>=result->rows) {return __FAIL;}
-  //If the result is impossible from the transform
-  if (transform->rows!=result->rows) {return __FAIL;}
+//Multiplies two blocks of elements, Write = alpha*Read1*Read2 + beta*Write (Write must not overlap with either of them).
+//Large multiplications use cache blocks if 'pack' has room for them (MX_GEMM_PACK elements), and otherwise 'pack' may be null
+static void mxGemmKernel(mxElement_t *write, unsigned int writeStride, double alpha, const mxElement_t *read1, unsigned int read1Stride, const mxElement_t *read2, unsigned int read2Stride, double beta, unsigned int rows, unsigned int inner, unsigned int columns, mxElement_t *pack) {
+  /* Scale Write by beta first (if beta is 0, Write is cleared, so it doesn't need to be initialised) */
+  //For each row
+  for (unsigned int r=0; r<rows; r++) {
+    //For each column
+    for (unsigned int c=0; c<columns; c++) {
+      write[r*writeStride+c] = (beta==0)? 0:write[r*writeStride+c]*beta;
+    }
+  }
 
-  //Get the determinant of the transform
-  mxElement_t det = mxDeterminant(transform);
-  //Copy the transform
-  matrix m;
-  mxCopy(&m, transform);
-  //For each index in the resulting vector
-  for (unsigned int i=0; i<result->rows; i++) {
-    //Copy this entry to the new matrix
-    m.elements[i][index] = result->elements[i][vector];
+  //If the matrices are large, and there's room to pack them, use the blocked multiplication
+  if ((pack!=0)&&((unsigned long)rows*inner*columns>MX_GEMM_THRESHOLD)) {
+#if MX_SIZE*MX_SIZE*MX_SIZE>MX_GEMM_THRESHOLD
+    //If a fixed-size function asked for it, pack them on the stack
+    if (pack==__FIXED_PACK) {
+      mxGemmBlockedStack(write, writeStride, alpha, read1, read1Stride, read2, read2Stride, rows, inner, columns);
+      return;
+    }
+#endif
+    mxGemmBlocked(write, writeStride, alpha, read1, read1Stride, read2, read2Stride, rows, inner, columns, pack);
+    return;
   }
-  //Get the determinant of the new matrix
-  mxElement_t newDet = mxDeterminant(&m);
 
-  //If there are infinite solutions
-  if ((det==0)&&(newDet==0)) {return __INF_SOLUTIONS;}
-  //If there are no solutions
-  if ((det==0)&&(newDet!=0)) {return __FAIL;}
-  //Otherwise, there is one solution, using Cramer's Rule
-  return (newDet/det);
+  /* Small matrices are multiplied directly, walking along the rows of Read2 */
+  //Whether the rows can be done with the SIMD path
+  bool simd = __MX_DOUBLE&&(mxSimdPath()!=MX_SIMD_SCALAR);
+  //For each row
+  for (unsigned int r=0; r<rows; r++) {
+    //For each term
+    for (unsigned int i=0; i<inner; i++) {
+      //The scaled entry from Read1 that multiplies this row of Read2
+      mxElement_t scalar = read1[r*read1Stride+i]*alpha;
+      //If possible, use the SIMD path for this row
+      if (simd) {
+        mxSimdAxpy((double*)write+r*writeStride, scalar, (const double*)read2+i*read2Stride, columns);
+        continue;
+      }
+      //For each column, increase the sum by the product
+      for (unsigned int c=0; c<columns; c++) {write[r*writeStride+c] += scalar * read2[i*read2Stride+c];}
+    }
+  }
 }
 
-//Solves for all vectors using the inverse of the transformation
-bool mxSolveInverse(matrix *write, const matrix *transform, const matrix *result) {
-  //Save Write as the inverse of the Transform
-  if (!mxInverse(write, transform)) {
-    //If this process __FAILs
-    return false;
+//Subtracts a multiple of a pivot row from a row, in the block being reduced and the collateral block in the same pass
+static void mxReduceRowKernel(mxElement_t *row, const mxElement_t *pivot, unsigned int columns, mxElement_t *collateralRow, const mxElement_t *collateralPivot, unsigned int collateralColumns, mxElement_t scalar) {
+  //If possible, use the SIMD path (which also updates both rows in one pass)
+  if (__MX_DOUBLE&&(mxSimdPath()!=MX_SIMD_SCALAR)) {
+    mxSimdAxpy2((double*)row, (const double*)pivot, columns, (double*)collateralRow, (const double*)collateralPivot, collateralColumns, -scalar);
+    return;
   }
-  //Save Write as the multiplication of the inverse and the result
-  mxMultiply(write, write, result);
-
-  //Indicate that the process was successful
-  return true;
+  //For the columns both blocks have, decrease each element in both rows by the scalar multiple of the pivot rows
+  unsigned int c = 0;
+  for (; (c<columns)&&(c<collateralColumns); c++) {
+    row[c] -= scalar*pivot[c];
+    collateralRow[c] -= scalar*collateralPivot[c];
+  }
+  //Then finish whichever row is longer
+  for (unsigned int k=c; k<columns; k++) {row[k] -= scalar*pivot[k];}
+  for (unsigned int k=c; k<collateralColumns; k++) {collateralRow[k] -= scalar*collateralPivot[k];}
 }
 
-//Turns a matrix into Reduced Row Echelon Form, and edits 1 additional matrix as collateral
-void mxReducedEchelon_coll(matrix *writeReduce, matrix *writeCollateral, const matrix *readReduce, const matrix *readCollateral) {
-  //Copy the matrices
-  mxCopy(writeReduce, readReduce);
-  mxCopy(writeCollateral, readCollateral);
+//Turns a block of elements into Reduced Row Echelon Form in place, and edits 1 additional block as collateral.
+//Rows are never swapped: row r of the result is left in the stored row order[r] (see mxReorderRows)
+static void mxReduceKernel(mxElement_t *reduce, unsigned int reduceStride, unsigned int rows, unsigned int columns, mxElement_t *collateral, unsigned int collateralStride, unsigned int collateralColumns, unsigned int *order) {
+  //Start with every row where it's stored
+  for (unsigned int r=0; r<rows; r++) {order[r] = r;}
 
   /* When a column with no non-zero pivot is found, it introduces a free-variable.
   The row of the next pivot will be the same row there should've been a pivot,
   so the row for any pivot we're looking for is columnNum minus numOfFreeVariables */
-  int numFreeVar = 0;
+  unsigned int numFreeVar = 0;
   //For each index along the diagonal
-  for (unsigned int i=0; (i<writeReduce->columns)&&(i-numFreeVar<writeReduce->rows); i++) {
-    //The starting row to consider for a pivot is on the diagonal, minus the free variables found
-    int r = i-numFreeVar;
-    //Search for a non-zero pivot
-    while ((writeReduce->elements[r][i]==0)&&(r+1<writeReduce->rows)) {r++;}
+  for (unsigned int i=0; (i<columns)&&(i-numFreeVar<rows); i++) {
+    //The row the pivot belongs in is on the diagonal, minus the free variables found
+    unsigned int p = i-numFreeVar;
+    //Search for a non-zero pivot, starting at that row
+    unsigned int r = p;
+    while ((reduce[order[r]*reduceStride+i]==0)&&(r+1<rows)) {r++;}
 
     //If a non-zero was not found
-    if (writeReduce->elements[r][i]==0) {
+    if (reduce[order[r]*reduceStride+i]==0) {
       //Then we've found a free variable
       numFreeVar++;
     } else {
-      /* Swap the pivot row and the row with a non-zero pivot */
-      //For each column after the completed columns, in the matrix we're reducing
-      for (unsigned int c=i; c<writeReduce->columns; c++) {
-        //Temporarily store the value from the main row
-        mxElement_t temp = writeReduce->elements[i-numFreeVar][c];
-        //Replace the value in the main row
-        writeReduce->elements[i-numFreeVar][c] = writeReduce->elements[r][c];
-        //Replace the value in the row that was found
-        writeReduce->elements[r][c] = temp;
-      }
-      //For each column in the collateral matrix
-      for (unsigned int c=0; c<writeCollateral->columns; c++) {
-        //Temporarily store the value from the main row
-        mxElement_t temp = writeCollateral->elements[i-numFreeVar][c];
-        //Replace the value in the main row
-        writeCollateral->elements[i-numFreeVar][c] = writeCollateral->elements[r][c];
-        //Replace the value in the row that was found
-        writeCollateral->elements[r][c] = temp;
-      }
+      //Swap the pivot row and the row with a non-zero pivot, by swapping their places in the order
+      unsigned int temp = order[p];
+      order[p] = order[r];
+      order[r] = temp;
+      //Shorthand for the pivot rows
+      const mxElement_t *pivot = reduce+order[p]*reduceStride;
+      const mxElement_t *collateralPivot = collateral+order[p]*collateralStride;
 
       /* Reduce this column */
       //For each row
-      for (unsigned int r=0; r<writeReduce->rows; r++) {
+      for (unsigned int r=0; r<rows; r++) {
         //If this row isn't the pivot
-        if (r!=i-numFreeVar) {
+        if (r!=p) {
           //Set the scalar multiple needed
-          double scalar = writeReduce->elements[r][i]/writeReduce->elements[i-numFreeVar][i];
-          /* Perform the row operation */
-          //For each column after the completed columns, in the matrix we're reducing
-          for (unsigned int c=i; c<writeReduce->columns; c++) {
-            //Decrease each element in the row by the scalar multiple of the pivot row
-            writeReduce->elements[r][c] -= scalar*writeReduce->elements[i-numFreeVar][c];
-          }
-          //For each column in the collateral matrix
-          for (unsigned int c=0; c<writeCollateral->columns; c++) {
-            //Decrease each element in the row by the scalar multiple of the pivot row
-            writeCollateral->elements[r][c] -= scalar*writeCollateral->elements[i-numFreeVar][c];
-          }
+          mxElement_t scalar = reduce[order[r]*reduceStride+i]/pivot[i];
+          //If the row already has a zero in this column, there's nothing to do
+          if (scalar==0) {continue;}
+          //Perform the row operation, on the columns after this one, and on the collateral
+          mxReduceRowKernel(reduce+order[r]*reduceStride+i+1, pivot+i+1, columns-i-1, collateral+order[r]*collateralStride, collateralPivot, collateralColumns, scalar);
+          //This column is eliminated exactly (a fused multiply-add could leave a rounding residue, which would look like a pivot)
+          reduce[order[r]*reduceStride+i] = 0;
         }
       }
     }
   }
 }
 
-//Turns a matrix into Reduced Row Echelon Form
-void mxReducedEchelon(matrix *write, const matrix *read) {
-  //Creating a zero matrix
-  matrix zero;
-  mxZero(&zero);
-
-  //Turning the matrix into Reduced Row Echelon Form
-  mxReducedEchelon_coll(write, &zero, read, &zero);
+//Moves the rows of two blocks into the order left by mxReduceKernel (so row r takes stored row order[r]), following each cycle
+//of the permutation so every row is swapped at most once. 'order' is used up (it's left as the identity)
+static void mxReorderRows(mxElement_t *reduce, unsigned int reduceStride, unsigned int rows, unsigned int columns, mxElement_t *collateral, unsigned int collateralStride, unsigned int collateralColumns, unsigned int *order) {
+  //For each row of the result
+  for (unsigned int r=0; r<rows; r++) {
+    //Follow the cycle that starts here, where 'j' holds the stored row r until the cycle closes
+    unsigned int j = r;
+    while (order[j]!=r) {
+      //The stored row that belongs in place j
+      unsigned int from = order[j];
+      //Swap the two rows, in both blocks
+      for (unsigned int c=0; c<columns; c++) {
+        mxElement_t temp = reduce[j*reduceStride+c];
+        reduce[j*reduceStride+c] = reduce[from*reduceStride+c];
+        reduce[from*reduceStride+c] = temp;
+      }
+      for (unsigned int c=0; c<collateralColumns; c++) {
+        mxElement_t temp = collateral[j*collateralStride+c];
+        collateral[j*collateralStride+c] = collateral[from*collateralStride+c];
+        collateral[from*collateralStride+c] = temp;
+      }
+      //Mark place j as done, and move along the cycle
+      order[j] = j;
+      j = from;
+    }
+    order[j] = j;
+  }
 }
 
-//Solves for all vectors where possible, using Guass reduction
-bool mxSolveGauss(matrix *write, const matrix *transform, const matrix *result) {
-  //If the result is impossible from the transform
-  if (transform->rows!=result->rows) {return false;}
+//Householder QR of row-major elements, in place (rows>=columns).
+//R is left on and above the diagonal, and each reflector I-tau*v*v' is left below the diagonal (v's leading 1 isn't stored)
+static void mxQRKernel(mxElement_t *a, unsigned int stride, unsigned int rows, unsigned int columns, mxElement_t *tau) {
+  //For each column
+  for (unsigned int k=0; k<columns; k++) {
+    /* Make the reflector that zeroes the column below the diagonal */
+    mxElement_t alpha = a[k*stride+k];
+    mxElement_t sigma = 0;
+    for (unsigned int i=k+1; i<rows; i++) {sigma += a[i*stride+k]*a[i*stride+k];}
+    //If the column is already zero below the diagonal, no reflection is needed
+    if (sigma==0) {
+      tau[k] = 0;
+      continue;
+    }
+    //Reflect onto beta, which has the opposite sign to alpha (so there's no cancellation)
+    mxElement_t beta = sqrt(alpha*alpha+sigma);
+    if (alpha>0) {beta = -beta;}
+    tau[k] = (beta-alpha)/beta;
+    mxElement_t scale = 1/(alpha-beta);
+    for (unsigned int i=k+1; i<rows; i++) {a[i*stride+k] *= scale;}
+    a[k*stride+k] = beta;
 
-  //Set the size
-  write->rows = transform->columns;
-  write->columns = result->columns;
+    /* Apply the reflector to the rest of the columns */
+    for (unsigned int c=k+1; c<columns; c++) {
+      //Dot product of v and the column
+      mxElement_t dot = a[k*stride+c];
+      for (unsigned int i=k+1; i<rows; i++) {dot += a[i*stride+k]*a[i*stride+c];}
+      dot *= tau[k];
+      //Decrease the column by the multiple of v
+      a[k*stride+c] -= dot;
+      for (unsigned int i=k+1; i<rows; i++) {a[i*stride+c] -= dot*a[i*stride+k];}
+    }
+  }
+}
 
-  //Creating new matrices to do row operations on
-  matrix transform0;
-  matrix result0;
+//Multiplies row-major elements by Q' from mxQRKernel, in place
+static void mxQRApplyTranspose(const mxElement_t *qr, unsigned int qrStride, unsigned int rows, unsigned int reflectors, const mxElement_t *tau, mxElement_t *c, unsigned int cStride, unsigned int cColumns) {
+  //For each reflector, in the order they were made
+  for (unsigned int k=0; k<reflectors; k++) {
+    //If there was no reflection
+    if (tau[k]==0) {continue;}
+    //For each column
+    for (unsigned int j=0; j<cColumns; j++) {
+      //Dot product of v and the column
+      mxElement_t dot = c[k*cStride+j];
+      for (unsigned int i=k+1; i<rows; i++) {dot += qr[i*qrStride+k]*c[i*cStride+j];}
+      dot *= tau[k];
+      //Decrease the column by the multiple of v
+      c[k*cStride+j] -= dot;
+      for (unsigned int i=k+1; i<rows; i++) {c[i*cStride+j] -= dot*qr[i*qrStride+k];}
+    }
+  }
+}
 
-  //Gauss Reduction
-  mxReducedEchelon_coll(&transform0, &result0, transform, result);
+//Solves R*x = c in place, for each column of c, where R is the upper triangle of row-major elements.
+//Returns false if R has a zero on its diagonal
+static bool mxUpperSubstitute(const mxElement_t *r, unsigned int rStride, unsigned int size, mxElement_t *c, unsigned int cStride, unsigned int cColumns) {
+  //If R is singular
+  for (unsigned int i=0; i<size; i++) {
+    if (r[i*rStride+i]==0) {return false;}
+  }
+  //Backward substitution, for each row from the bottom
+  for (unsigned int i=size; i-->0;) {
+    for (unsigned int j=0; j<cColumns; j++) {
+      mxElement_t entry = c[i*cStride+j];
+      for (unsigned int k=i+1; k<size; k++) {entry -= r[i*rStride+k]*c[k*cStride+j];}
+      c[i*cStride+j] = entry/r[i*rStride+i];
+    }
+  }
+  return true;
+}
 
-  /* To solve for the vectors, we're going to make all free variables equal 0,
-  and only pivots will have a non-zero value */
-  //Whether a variable has been solved for or not
-  bool solved[transform0.columns];
-  //Note that none of the variables have been solved for
-  for (unsigned int i=0; i<transform0.columns; i++) {solved[i] = 0;}
-  //For each row in the transformation
-  for (unsigned int r=0; r<transform0.rows; r++) {
-    //Start with the first column
-    int c=0;
-    //Search for the pivot, left to right
-    while ((transform0.elements[r][c]==0)&&(c+1<transform0.columns)) {c++;}
-    //For each output vector
-    for (unsigned int v=0; v<result0.columns; v++) {
-      //If no pivot was found
-      if (transform0.elements[r][c]==0) {
-        //If the result is non-zero
-        if (result0.elements[r][v]!=0) {
-          //Then there is no possible solution
-          return false;
+/* The following kernels find the eigenvalues and eigenvectors of symmetric row-major elements.
+The matrix is reduced to a tridiagonal matrix T = Q'*A*Q with Householder reflections, then T is
+diagonalised with the implicit QL algorithm (or its eigenvectors are found by inverse iteration) */
+
+//Reduces symmetric row-major elements to tridiagonal form, in place (the whole matrix is read and changed).
+//The diagonal is written to d, the subdiagonal to e, and each reflector I-tau*v*v' is left below the subdiagonal
+static void mxTridiagonalKernel(mxElement_t *a, unsigned int stride, unsigned int n, mxElement_t *d, mxElement_t *e, mxElement_t *tau, mxElement_t *p) {
+  //For each column but the last
+  for (unsigned int i=0; i+1<n; i++) {
+    /* Make the reflector that zeroes the column below the subdiagonal */
+    mxElement_t alpha = a[(i+1)*stride+i];
+    mxElement_t sigma = 0;
+    for (unsigned int r=i+2; r<n; r++) {sigma += a[r*stride+i]*a[r*stride+i];}
+    d[i] = a[i*stride+i];
+    //If the column is already zero below the subdiagonal, no reflection is needed
+    if (sigma==0) {
+      tau[i] = 0;
+      e[i] = alpha;
+      continue;
+    }
+    mxElement_t beta = sqrt(alpha*alpha+sigma);
+    if (alpha>0) {beta = -beta;}
+    tau[i] = (beta-alpha)/beta;
+    mxElement_t scale = 1/(alpha-beta);
+    for (unsigned int r=i+2; r<n; r++) {a[r*stride+i] *= scale;}
+    e[i] = beta;
+
+    /* Apply the reflector to both sides of the rest of the matrix: A = A-v*w'-w*v',
+    where p = tau*A*v and w = p-(tau/2)*(p'*v)*v (v is 1 in row i+1, then the stored column) */
+    mxElement_t half = 0;
+    for (unsigned int r=i+1; r<n; r++) {
+      mxElement_t sum = a[r*stride+i+1];
+      for (unsigned int c=i+2; c<n; c++) {sum += a[r*stride+c]*a[c*stride+i];}
+      p[r] = tau[i]*sum;
+      half += p[r]*((r==i+1)? 1:a[r*stride+i]);
+    }
+    half *= tau[i]/2;
+    for (unsigned int r=i+1; r<n; r++) {p[r] -= half*((r==i+1)? 1:a[r*stride+i]);}
+    for (unsigned int r=i+1; r<n; r++) {
+      mxElement_t vr = (r==i+1)? 1:a[r*stride+i];
+      for (unsigned int c=i+1; c<n; c++) {
+        mxElement_t vc = (c==i+1)? 1:a[c*stride+i];
+        a[r*stride+c] -= vr*p[c]+p[r]*vc;
+      }
+    }
+  }
+  //The last diagonal entry, and no subdiagonal past it
+  if (n>0) {
+    d[n-1] = a[(n-1)*stride+n-1];
+    e[n-1] = 0;
+  }
+}
+
+//Multiplies row-major elements (with 'rows' equal to n) by Q from mxTridiagonalKernel, in place
+static void mxTridiagonalBack(const mxElement_t *a, unsigned int stride, unsigned int n, const mxElement_t *tau, mxElement_t *z, unsigned int zStride, unsigned int zColumns, mxElement_t *w) {
+  //For each reflector, last to first
+  for (unsigned int i=n-1; i-->0;) {
+    //If there was no reflection
+    if (tau[i]==0) {continue;}
+    //w = v'*z (going along the rows)
+    for (unsigned int c=0; c<zColumns; c++) {w[c] = z[(i+1)*zStride+c];}
+    for (unsigned int r=i+2; r<n; r++) {
+      for (unsigned int c=0; c<zColumns; c++) {w[c] += a[r*stride+i]*z[r*zStride+c];}
+    }
+    //z = z-tau*v*w
+    for (unsigned int c=0; c<zColumns; c++) {z[(i+1)*zStride+c] -= tau[i]*w[c];}
+    for (unsigned int r=i+2; r<n; r++) {
+      mxElement_t scalar = tau[i]*a[r*stride+i];
+      for (unsigned int c=0; c<zColumns; c++) {z[r*zStride+c] -= scalar*w[c];}
+    }
+  }
+}
+
+//Finds the eigenvalues of a tridiagonal matrix in place (in d), using the implicit QL algorithm.
+//If z isn't null, the same rotations are applied to its columns. Returns false if it doesn't converge
+static bool mxTridiagonalQL(mxElement_t *d, mxElement_t *e, unsigned int n, mxElement_t *z, unsigned int zStride, unsigned int zRows) {
+  //For each eigenvalue
+  for (unsigned int l=0; l<n; l++) {
+    unsigned int iterations = 0;
+    unsigned int m;
+    do {
+      //Look for a small subdiagonal entry, which splits the matrix
+      for (m=l; m+1<n; m++) {
+        mxElement_t dd = __ABS(d[m])+__ABS(d[m+1]);
+        if ((mxElement_t)(__ABS(e[m])+dd)==dd) {break;}
+      }
+      //If the eigenvalue hasn't separated yet
+      if (m!=l) {
+        if (iterations++==30) {return false;}
+        //Form the shift
+        mxElement_t g = (d[l+1]-d[l])/(2*e[l]);
+        mxElement_t r = hypot(g, 1);
+        g = d[m]-d[l]+e[l]/(g+((g<0)? -r:r));
+        mxElement_t s = 1;
+        mxElement_t c = 1;
+        mxElement_t p = 0;
+        bool underflow = false;
+        //A plane rotation for each row, chasing the bulge up to row l
+        for (unsigned int i=m; i-->l;) {
+          mxElement_t f = s*e[i];
+          mxElement_t b = c*e[i];
+          r = hypot(f, g);
+          e[i+1] = r;
+          //If the rotation underflows, the matrix has split
+          if (r==0) {
+            d[i+1] -= p;
+            e[m] = 0;
+            underflow = true;
+            break;
+          }
+          s = f/r;
+          c = g/r;
+          g = d[i+1]-p;
+          r = (d[i]-g)*s+2*c*b;
+          p = s*r;
+          d[i+1] = g+p;
+          g = c*r-b;
+          //Rotate the columns of z
+          if (z!=0) {
+            for (unsigned int k=0; k<zRows; k++) {
+              f = z[k*zStride+i+1];
+              z[k*zStride+i+1] = s*z[k*zStride+i]+c*f;
+              z[k*zStride+i] = c*z[k*zStride+i]-s*f;
+            }
+          }
+        }
+        if (underflow) {continue;}
+        d[l] -= p;
+        e[l] = g;
+        e[m] = 0;
+      }
+    } while (m!=l);
+  }
+  return true;
+}
+
+//Finds the eigenvector of a tridiagonal matrix for a known eigenvalue, using inverse iteration.
+//The vector is written to a column of z (with zStride), and kept orthogonal to the 'previous' columns before it
+static void mxTridiagonalVector(const mxElement_t *d, const mxElement_t *e, unsigned int n, mxElement_t lambda, mxElement_t *z, unsigned int zStride, unsigned int previous, mxElement_t *work) {
+  //Shorthand for the workspace: the factored rows (3 diagonals), and the vector
+  mxElement_t *diagonal = work;
+  mxElement_t *upper = work+n;
+  mxElement_t *upper2 = work+2*n;
+  mxElement_t *x = work+3*n;
+  //Size of T, to decide what counts as a zero pivot
+  mxElement_t norm = 0;
+  for (unsigned int i=0; i<n; i++) {
+    mxElement_t bound = __ABS(d[i])+__ABS(e[i])+((i>0)? __ABS(e[i-1]):0);
+    if (bound>norm) {norm = bound;}
+  }
+  mxElement_t tiny = norm*1e-14;
+  if (tiny==0) {tiny = 1e-30;}
+
+  //Start from a spread-out vector, which won't be orthogonal to the eigenvector (and is different for each column)
+  unsigned int seed = 12345+previous;
+  for (unsigned int i=0; i<n; i++) {
+    seed = seed*1103515245+12345;
+    x[i] = 1+(mxElement_t)((seed>>16)&0x7fff)/0x8000;
+  }
+
+  //A few iterations converge, because the eigenvalue is already accurate
+  for (unsigned int iteration=0; iteration<3; iteration++) {
+    /* Solve (T-lambda*I)*y = x, using Gauss elimination with row swaps (pivoting) */
+    for (unsigned int i=0; i<n; i++) {
+      diagonal[i] = d[i]-lambda;
+      upper[i] = e[i];
+      upper2[i] = 0;
+    }
+    for (unsigned int i=0; i+1<n; i++) {
+      //The entry below the pivot
+      mxElement_t below = e[i];
+      //If the row below has the larger pivot, swap the rows
+      if (__ABS(below)>__ABS(diagonal[i])) {
+        mxElement_t scalar = diagonal[i]/below;
+        mxElement_t temp;
+        diagonal[i] = below;
+        temp = upper[i];
+        upper[i] = diagonal[i+1];
+        diagonal[i+1] = temp-scalar*diagonal[i+1];
+        if (i+2<n) {
+          upper2[i] = upper[i+1];
+          upper[i+1] = -scalar*upper[i+1];
         }
+        temp = x[i];
+        x[i] = x[i+1];
+        x[i+1] = temp-scalar*x[i+1];
       } else {
-        //Solve for the pivot-variable
-        write->elements[c][v] = result0.elements[r][v]/transform0.elements[r][c];
-        //Note that the variable has been solved for
-        solved[c] = 1;
+        //If the pivot is zero, nudge it (T-lambda*I is meant to be nearly singular)
+        if (diagonal[i]==0) {diagonal[i] = tiny;}
+        mxElement_t scalar = below/diagonal[i];
+        diagonal[i+1] -= scalar*upper[i];
+        x[i+1] -= scalar*x[i];
       }
     }
+    if (diagonal[n-1]==0) {diagonal[n-1] = tiny;}
+    //Backward substitution
+    for (unsigned int i=n; i-->0;) {
+      mxElement_t entry = x[i];
+      if (i+1<n) {entry -= upper[i]*x[i+1];}
+      if (i+2<n) {entry -= upper2[i]*x[i+2];}
+      x[i] = entry/diagonal[i];
+    }
+
+    //Remove the parts along the previous eigenvectors (which matters when eigenvalues are close)
+    for (unsigned int j=0; j<previous; j++) {
+      mxElement_t dot = 0;
+      for (unsigned int i=0; i<n; i++) {dot += x[i]*z[i*zStride+j];}
+      for (unsigned int i=0; i<n; i++) {x[i] -= dot*z[i*zStride+j];}
+    }
+    //Normalise the vector
+    mxElement_t length = 0;
+    for (unsigned int i=0; i<n; i++) {length += x[i]*x[i];}
+    length = sqrt(length);
+    if (length==0) {length = 1;}
+    for (unsigned int i=0; i<n; i++) {x[i] /= length;}
   }
-  //For each variable
-  for (unsigned int i=0; i<transform0.columns; i++) {
-    //If this variable was not solved for
-    if (!solved[i]) {
-      //For each vector
-      for (unsigned int v=0; v<result0.columns; v++) {
-        //Set the solution to 0
-        write->elements[i][v] = 0;
+
+  //Write the vector into its column
+  for (unsigned int i=0; i<n; i++) {z[i*zStride+previous] = x[i];}
+}
+
+//Finds the 'count' largest eigenvalues (and optionally eigenvectors) of symmetric row-major elements.
+//'a' is destroyed, and 'work' needs 10*n elements
+static bool mxEigenKernel(mxElement_t *values, mxElement_t *vectors, unsigned int vectorStride, mxElement_t *a, unsigned int stride, unsigned int n, unsigned int count, mxElement_t *work) {
+  //Shorthand for the workspace
+  mxElement_t *d = work;
+  mxElement_t *e = work+n;
+  mxElement_t *tau = work+2*n;
+  mxElement_t *p = work+3*n;
+  mxElement_t *d0 = work+4*n;
+  mxElement_t *e0 = work+5*n;
+  //If the matrix is empty, there's nothing to find
+  if (n==0) {return true;}
+  //Reduce to tridiagonal form
+  mxTridiagonalKernel(a, stride, n, d, e, tau, p);
+
+  /* All of the eigenvectors: rotate the identity along with T, then multiply by Q */
+  if ((vectors!=0)&&(count==n)) {
+    for (unsigned int r=0; r<n; r++) {
+      for (unsigned int c=0; c<n; c++) {vectors[r*vectorStride+c] = (r==c)? 1:0;}
+    }
+    if (!mxTridiagonalQL(d, e, n, vectors, vectorStride, n)) {return false;}
+    mxTridiagonalBack(a, stride, n, tau, vectors, vectorStride, n, p);
+    //Sort the eigenvalues from largest to smallest, along with their eigenvectors
+    for (unsigned int i=0; i<n; i++) {
+      unsigned int largest = i;
+      for (unsigned int j=i+1; j<n; j++) {
+        if (d[j]>d[largest]) {largest = j;}
+      }
+      if (largest!=i) {
+        mxElement_t temp = d[i];
+        d[i] = d[largest];
+        d[largest] = temp;
+        for (unsigned int r=0; r<n; r++) {
+          temp = vectors[r*vectorStride+i];
+          vectors[r*vectorStride+i] = vectors[r*vectorStride+largest];
+          vectors[r*vectorStride+largest] = temp;
+        }
+      }
+      values[i] = d[i];
+    }
+    return true;
+  }
+
+  /* Only the eigenvalues first (keeping a copy of T for the eigenvectors) */
+  for (unsigned int i=0; i<n; i++) {
+    d0[i] = d[i];
+    e0[i] = e[i];
+  }
+  if (!mxTridiagonalQL(d, e, n, 0, 0, 0)) {return false;}
+  //Pick the largest eigenvalues, from largest to smallest
+  for (unsigned int i=0; i<count; i++) {
+    unsigned int largest = i;
+    for (unsigned int j=i+1; j<n; j++) {
+      if (d[j]>d[largest]) {largest = j;}
+    }
+    mxElement_t temp = d[i];
+    d[i] = d[largest];
+    d[largest] = temp;
+    values[i] = d[i];
+  }
+
+  /* Then their eigenvectors: inverse iteration with T, then multiply by Q */
+  if (vectors!=0) {
+    for (unsigned int j=0; j<count; j++) {mxTridiagonalVector(d0, e0, n, values[j], vectors, vectorStride, j, work+6*n);}
+    mxTridiagonalBack(a, stride, n, tau, vectors, vectorStride, count, p);
+  }
+  return true;
+}
+
+//Turns Householder reflectors from mxQRKernel into the first 'columns' columns of Q, in place
+static void mxQRFormQ(mxElement_t *a, unsigned int stride, unsigned int rows, unsigned int columns, const mxElement_t *tau) {
+  //For each reflector, last to first
+  for (unsigned int k=columns; k-->0;) {
+    //Apply it to the columns of Q that are already formed
+    for (unsigned int c=k+1; c<columns; c++) {
+      mxElement_t dot = a[k*stride+c];
+      for (unsigned int i=k+1; i<rows; i++) {dot += a[i*stride+k]*a[i*stride+c];}
+      dot *= tau[k];
+      a[k*stride+c] -= dot;
+      for (unsigned int i=k+1; i<rows; i++) {a[i*stride+c] -= dot*a[i*stride+k];}
+    }
+    //Then its own column is the first column of the reflector
+    for (unsigned int i=k+1; i<rows; i++) {a[i*stride+k] *= -tau[k];}
+    a[k*stride+k] = 1-tau[k];
+    for (unsigned int i=0; i<k; i++) {a[i*stride+k] = 0;}
+  }
+}
+
+//Singular value decomposition of row-major elements (rows>=columns), using one-sided Jacobi rotations.
+//'a' is replaced by U, the singular values are written from largest to smallest, and V is written to 'v'.
+//Returns false if it doesn't converge
+static bool mxSVDKernel(mxElement_t *a, unsigned int stride, unsigned int rows, unsigned int columns, mxElement_t *values, mxElement_t *v, unsigned int vStride) {
+  //Start V as the identity
+  for (unsigned int r=0; r<columns; r++) {
+    for (unsigned int c=0; c<columns; c++) {v[r*vStride+c] = (r==c)? 1:0;}
+  }
+
+  //Length of all the elements together (which the rotations don't change)
+  mxElement_t total = 0;
+  for (unsigned int r=0; r<rows; r++) {
+    for (unsigned int c=0; c<columns; c++) {total += a[r*stride+c]*a[r*stride+c];}
+  }
+  total = sqrt(total);
+
+  /* Rotate pairs of columns until every pair is orthogonal (A*V keeps the same product) */
+  bool rotated = true;
+  for (unsigned int sweep=0; rotated; sweep++) {
+    if (sweep==60) {return false;}
+    rotated = false;
+    //For each pair of columns
+    for (unsigned int p=0; p+1<columns; p++) {
+      for (unsigned int q=p+1; q<columns; q++) {
+        //Lengths of the columns, and their dot product
+        mxElement_t alpha = 0;
+        mxElement_t beta = 0;
+        mxElement_t gamma = 0;
+        for (unsigned int i=0; i<rows; i++) {
+          alpha += a[i*stride+p]*a[i*stride+p];
+          beta += a[i*stride+q]*a[i*stride+q];
+          gamma += a[i*stride+p]*a[i*stride+q];
+        }
+        //If either column is only rounding error (from a rank-deficient matrix), it's left alone
+        if (((mxElement_t)(total+sqrt(alpha))==total)||((mxElement_t)(total+sqrt(beta))==total)) {continue;}
+        //If the columns are already orthogonal (to within rounding of the dot product)
+        mxElement_t scale = sqrt(alpha*beta);
+        if ((mxElement_t)(scale+__ABS(gamma)*0.01)==scale) {continue;}
+        rotated = true;
+        //The rotation that makes them orthogonal
+        mxElement_t zeta = (beta-alpha)/(2*gamma);
+        mxElement_t t = 1/(__ABS(zeta)+sqrt(1+zeta*zeta));
+        if (zeta<0) {t = -t;}
+        mxElement_t c = 1/sqrt(1+t*t);
+        mxElement_t s = c*t;
+        //Rotate the columns of A and V
+        for (unsigned int i=0; i<rows; i++) {
+          mxElement_t ap = a[i*stride+p];
+          mxElement_t aq = a[i*stride+q];
+          a[i*stride+p] = c*ap-s*aq;
+          a[i*stride+q] = s*ap+c*aq;
+        }
+        for (unsigned int i=0; i<columns; i++) {
+          mxElement_t vp = v[i*vStride+p];
+          mxElement_t vq = v[i*vStride+q];
+          v[i*vStride+p] = c*vp-s*vq;
+          v[i*vStride+q] = s*vp+c*vq;
+        }
+      }
+    }
+  }
+
+  /* The singular values are the lengths of the columns, and U is the columns normalised */
+  for (unsigned int c=0; c<columns; c++) {
+    mxElement_t length = 0;
+    for (unsigned int i=0; i<rows; i++) {length += a[i*stride+c]*a[i*stride+c];}
+    length = sqrt(length);
+    values[c] = length;
+    //If the column is zero, it stays zero
+    if (length==0) {continue;}
+    for (unsigned int i=0; i<rows; i++) {a[i*stride+c] /= length;}
+  }
+  //Sort the singular values from largest to smallest, along with the columns of U and V
+  for (unsigned int i=0; i<columns; i++) {
+    unsigned int largest = i;
+    for (unsigned int j=i+1; j<columns; j++) {
+      if (values[j]>values[largest]) {largest = j;}
+    }
+    if (largest==i) {continue;}
+    mxElement_t temp = values[i];
+    values[i] = values[largest];
+    values[largest] = temp;
+    for (unsigned int r=0; r<rows; r++) {
+      temp = a[r*stride+i];
+      a[r*stride+i] = a[r*stride+largest];
+      a[r*stride+largest] = temp;
+    }
+    for (unsigned int r=0; r<columns; r++) {
+      temp = v[r*vStride+i];
+      v[r*vStride+i] = v[r*vStride+largest];
+      v[r*vStride+largest] = temp;
+    }
+  }
+  return true;
+}
+
+//Writes the pseudo-inverse V*inverse(S)*U' from a singular value decomposition, where singular values below the SVD tolerance
+//(relative to the largest) count as zero. 'ut' is U' as row-major elements, and is scaled in place
+static void mxPseudoInverseKernel(mxElement_t *write, unsigned int writeStride, const mxElement_t *v, unsigned int vStride, const mxElement_t *values, mxElement_t *ut, unsigned int utStride, unsigned int count, unsigned int rows, unsigned int columns, mxElement_t *pack) {
+  //Scale each row of U' by the inverse of its singular value (or zero)
+  for (unsigned int k=0; k<count; k++) {
+    mxElement_t scalar = (values[k]>__SVD_TOLERANCE(rows, columns)*values[0])? 1/values[k]:0;
+    for (unsigned int c=0; c<columns; c++) {ut[k*utStride+c] *= scalar;}
+  }
+  //Write = V*(inverse(S)*U')
+  mxGemmKernel(write, writeStride, 1, v, vStride, ut, utStride, 0, rows, count, columns, pack);
+}
+
+//Longest side of the pieces that the recursive transposes do directly
+#define __TRANSPOSE_LEAF 16
+
+//Transposes row-major elements into other row-major elements, by splitting the longer side in half until the
+//pieces fit in cache (whatever its size), so both the reads and the writes stay close together
+static void mxTransposeKernel(mxElement_t *write, unsigned int writeStride, const mxElement_t *read, unsigned int readStride, unsigned int rows, unsigned int columns) {
+  //If the piece is small enough, transpose it directly
+  if ((rows<=__TRANSPOSE_LEAF)&&(columns<=__TRANSPOSE_LEAF)) {
+    for (unsigned int r=0; r<rows; r++) {
+      for (unsigned int c=0; c<columns; c++) {write[c*writeStride+r] = read[r*readStride+c];}
+    }
+    return;
+  }
+  //Otherwise split the longer side
+  if (rows>=columns) {
+    unsigned int half = rows/2;
+    mxTransposeKernel(write, writeStride, read, readStride, half, columns);
+    mxTransposeKernel(write+half, writeStride, read+half*readStride, readStride, rows-half, columns);
+  } else {
+    unsigned int half = columns/2;
+    mxTransposeKernel(write, writeStride, read, readStride, rows, half);
+    mxTransposeKernel(write+half*writeStride, writeStride, read+half, readStride, rows, columns-half);
+  }
+}
+
+//Swaps a block of row-major elements with the transpose of another block (which doesn't overlap it), splitting like mxTransposeKernel
+static void mxTransposeSwapKernel(mxElement_t *block1, mxElement_t *block2, unsigned int stride, unsigned int rows, unsigned int columns) {
+  //If the piece is small enough, swap it directly
+  if ((rows<=__TRANSPOSE_LEAF)&&(columns<=__TRANSPOSE_LEAF)) {
+    for (unsigned int r=0; r<rows; r++) {
+      for (unsigned int c=0; c<columns; c++) {
+        mxElement_t temp = block1[r*stride+c];
+        block1[r*stride+c] = block2[c*stride+r];
+        block2[c*stride+r] = temp;
+      }
+    }
+    return;
+  }
+  //Otherwise split the longer side
+  if (rows>=columns) {
+    unsigned int half = rows/2;
+    mxTransposeSwapKernel(block1, block2, stride, half, columns);
+    mxTransposeSwapKernel(block1+half*stride, block2+half, stride, rows-half, columns);
+  } else {
+    unsigned int half = columns/2;
+    mxTransposeSwapKernel(block1, block2, stride, rows, half);
+    mxTransposeSwapKernel(block1+half, block2+half*stride, stride, rows, columns-half);
+  }
+}
+
+//Transposes square row-major elements in place, without a temporary: the diagonal blocks are transposed
+//in place, and the two blocks off the diagonal are swapped with each other's transpose
+static void mxTransposeSquareKernel(mxElement_t *a, unsigned int stride, unsigned int size) {
+  //If the piece is small enough, transpose it directly
+  if (size<=__TRANSPOSE_LEAF) {
+    for (unsigned int r=0; r<size; r++) {
+      for (unsigned int c=r+1; c<size; c++) {
+        mxElement_t temp = a[r*stride+c];
+        a[r*stride+c] = a[c*stride+r];
+        a[c*stride+r] = temp;
+      }
+    }
+    return;
+  }
+  //Otherwise split it into four blocks
+  unsigned int half = size/2;
+  mxTransposeSquareKernel(a, stride, half);
+  mxTransposeSquareKernel(a+half*stride+half, stride, size-half);
+  mxTransposeSwapKernel(a+half, a+half*stride, stride, half, size-half);
+}
+
+/* The matrix exponential uses scaling and squaring: A is scaled by 1/2^s until its norm is at most 1/2,
+the exponential of the scaled matrix is approximated by the (6,6) Padé approximant, then squared s times */
+
+//Writes exp(scale*Read) for a square block of n by n elements (Write may be Read).
+//Work needs space for 6*n*n+n elements. Returns false if Read isn't finite
+static bool mxExpKernel(mxElement_t *write, unsigned int writeStride, const mxElement_t *read, unsigned int readStride, unsigned int n, double scale, mxElement_t *work, mxElement_t *pack) {
+  //Find the infinity-norm (largest row sum) of the scaled matrix
+  double norm = 0;
+  for (unsigned int r=0; r<n; r++) {
+    double sum = 0;
+    for (unsigned int c=0; c<n; c++) {sum += __ABS(read[r*readStride+c]*scale);}
+    if (sum>norm) {norm = sum;}
+  }
+  //If the matrix isn't finite, the exponential can't be found
+  if (!isfinite(norm)) {return false;}
+  //Halve the scale until the norm is at most 1/2, counting the squarings needed afterwards
+  unsigned int squarings = 0;
+  while (norm>0.5) {
+    norm /= 2;
+    scale /= 2;
+    squarings++;
+  }
+
+  /* Workspace: the scaled matrix A, its powers A², A⁴ and A⁶, the odd part U, and tau for the solve */
+  unsigned int nn = n*n;
+  mxElement_t *a = work;
+  mxElement_t *a2 = work+nn;
+  mxElement_t *a4 = work+2*nn;
+  mxElement_t *a6 = work+3*nn;
+  mxElement_t *u = work+4*nn;
+  mxElement_t *spare = work+5*nn;
+  mxElement_t *tau = work+6*nn;
+  //Coefficients of the Padé approximant, c[j] = (12-j)!6!/(12!j!(6-j)!)
+  const double c[7] = {1.0, 1.0/2, 5.0/44, 1.0/66, 1.0/792, 1.0/15840, 1.0/665280};
+
+  //Scale the matrix, and find its even powers
+  mxScaleKernel(a, n, read, readStride, n, n, scale);
+  mxGemmKernel(a2, n, 1, a, n, a, n, 0, n, n, n, pack);
+  mxGemmKernel(a4, n, 1, a2, n, a2, n, 0, n, n, n, pack);
+  mxGemmKernel(a6, n, 1, a4, n, a2, n, 0, n, n, n, pack);
+  //The even part V = c0*I + c2*A² + c4*A⁴ + c6*A⁶ (written over A⁶),
+  //and the bracket of the odd part c1*I + c3*A² + c5*A⁴ (written over A⁴)
+  for (unsigned int i=0; i<nn; i++) {
+    a6[i] = c[6]*a6[i]+c[4]*a4[i]+c[2]*a2[i];
+    a4[i] = c[5]*a4[i]+c[3]*a2[i];
+  }
+  for (unsigned int i=0; i<n; i++) {
+    a6[i*n+i] += c[0];
+    a4[i*n+i] += c[1];
+  }
+  //The odd part U = A*(c1*I + c3*A² + c5*A⁴)
+  mxGemmKernel(u, n, 1, a, n, a4, n, 0, n, n, n, pack);
+  //The approximant is (V-U)⁻¹(V+U), so write V+U over A and V-U over V
+  for (unsigned int i=0; i<nn; i++) {
+    a[i] = a6[i]+u[i];
+    a6[i] -= u[i];
+  }
+  //Solve (V-U)X = V+U with a QR decomposition, leaving X in place of V+U
+  mxQRKernel(a6, n, n, n, tau);
+  mxQRApplyTranspose(a6, n, n, n, tau, a, n, n);
+  if (!mxUpperSubstitute(a6, n, n, a, n, n)) {return false;}
+
+  //Square the approximant back up, alternating between two blocks
+  mxElement_t *x = a;
+  mxElement_t *y = spare;
+  for (unsigned int k=0; k<squarings; k++) {
+    mxGemmKernel(y, n, 1, x, n, x, n, 0, n, n, n, pack);
+    mxElement_t *temp = x;
+    x = y;
+    y = temp;
+  }
+  //Write the exponential
+  for (unsigned int r=0; r<n; r++) {
+    for (unsigned int col=0; col<n; col++) {write[r*writeStride+col] = x[r*n+col];}
+  }
+  return true;
+}
+
+//Discretises a continuous state-space model with a zero-order hold: exp([A B; 0 0]*period) = [Ad Bd; 0 I].
+//A is n by n and B is n by m (both row-major). Work needs space for 8*(n+m)*(n+m)+n+m elements
+static bool mxDiscretiseKernel(mxElement_t *writeA, unsigned int writeAStride, mxElement_t *writeB, unsigned int writeBStride, const mxElement_t *a, unsigned int aStride, const mxElement_t *b, unsigned int bStride, unsigned int n, unsigned int m, double period, mxElement_t *work, mxElement_t *pack) {
+  //Shorthand for the size of the block matrix, and its place in the workspace
+  unsigned int size = n+m;
+  mxElement_t *block = work;
+  mxElement_t *exponential = work+size*size;
+  //Build the block matrix, with zeros in the bottom rows
+  for (unsigned int r=0; r<size; r++) {
+    for (unsigned int c=0; c<size; c++) {
+      mxElement_t entry = 0;
+      if ((r<n)&&(c<n)) {entry = a[r*aStride+c];}
+      if ((r<n)&&(c>=n)) {entry = b[r*bStride+c-n];}
+      block[r*size+c] = entry;
+    }
+  }
+  //Find its exponential
+  if (!mxExpKernel(exponential, size, block, size, size, period, work+2*size*size, pack)) {return false;}
+  //Copy out the discrete matrices
+  for (unsigned int r=0; r<n; r++) {
+    for (unsigned int c=0; c<n; c++) {writeA[r*writeAStride+c] = exponential[r*size+c];}
+    for (unsigned int c=0; c<m; c++) {writeB[r*writeBStride+c] = exponential[r*size+n+c];}
+  }
+  return true;
+}
+
+//Updates an n by n inverse in place to the inverse of (A+U*V'), where U and V are n by k (Sherman-Morrison-Woodbury):
+//(A+U*V')⁻¹ = A⁻¹ - A⁻¹*U*(I+V'*A⁻¹*U)⁻¹*V'*A⁻¹. Work needs space for 2*n*k+k*k+k elements.
+//Returns false (leaving the inverse unchanged) if the updated matrix is singular
+static bool mxWoodburyKernel(mxElement_t *inverse, unsigned int stride, unsigned int n, const mxElement_t *u, unsigned int uStride, const mxElement_t *v, unsigned int vStride, unsigned int k, mxElement_t *work, mxElement_t *pack) {
+  //Workspace: X = A⁻¹*U (n by k), Y = V'*A⁻¹ (k by n), the capacitance C = I+V'*X (k by k), and tau for its decomposition
+  mxElement_t *x = work;
+  mxElement_t *y = work+n*k;
+  mxElement_t *c = work+2*n*k;
+  mxElement_t *tau = work+2*n*k+k*k;
+
+  //X = A⁻¹*U
+  mxGemmKernel(x, k, 1, inverse, stride, u, uStride, 0, n, n, k, pack);
+  //Y = V'*A⁻¹, built a row of A⁻¹ at a time (so every pass is contiguous)
+  for (unsigned int i=0; i<k*n; i++) {y[i] = 0;}
+  for (unsigned int i=0; i<n; i++) {
+    for (unsigned int a=0; a<k; a++) {
+      mxElement_t scalar = v[i*vStride+a];
+      if (scalar==0) {continue;}
+      for (unsigned int j=0; j<n; j++) {y[a*n+j] += scalar*inverse[i*stride+j];}
+    }
+  }
+  //C = I+V'*X
+  for (unsigned int a=0; a<k; a++) {
+    for (unsigned int b=0; b<k; b++) {
+      mxElement_t sum = (a==b)? 1:0;
+      for (unsigned int i=0; i<n; i++) {sum += v[i*vStride+a]*x[i*k+b];}
+      c[a*k+b] = sum;
+    }
+  }
+  //Solve C*Z = Y with a QR decomposition, leaving Z in place of Y
+  mxQRKernel(c, k, k, k, tau);
+  mxQRApplyTranspose(c, k, k, k, tau, y, n, n);
+  if (!mxUpperSubstitute(c, k, k, y, n, n)) {return false;}
+  //A⁻¹ = A⁻¹ - X*Z
+  mxGemmKernel(inverse, stride, -1, x, k, y, n, 1, n, k, n, pack);
+  return true;
+}
+
+//Checks if two matrices are equal
+bool mxEqual(const matrix *read1, const matrix *read2) {
+  //If the sizes are different
+  if (!((read1->rows==read2->rows)&&(read1->columns==read2->columns))) {
+    //Then the matrices aren't equal
+    return false;
+  }
+  //For each row
+  for (unsigned int r=0; r<read1->rows; r++) {
+    //For each column
+    for (unsigned int c=0; c<read1->columns; c++) {
+      //If the entries are not the same
+      if (read1->elements[r][c]!=read2->elements[r][c]) {
+        //Then the matrices aren't equal
+        return false;
+      }
+    }
+  }
+  //If we've reached this step, the matrices are equal
+  return true;
+}
+
+//Empties a matrix
+void mxZero(matrix *write) {
+  //Set the sizze to 0
+  write->rows = 0;
+  write->columns = 0;
+  //For each row
+  for (unsigned int r=0; r<MX_SIZE; r++) {
+    //For each column
+    for (unsigned int c=0; c<MX_SIZE; c++) {
+      //Replace the entry with 0
+      write->elements[r][c] = 0;
+    }
+  }
+}
+
+//Turns a matrix into the identity matrix with a particular size
+bool mxIdentity(matrix *write, int size) {
+  //If the size is too large
+  if (size>MX_SIZE) {return false;}
+
+  //Set the size
+  write->rows = size;
+  write->columns = size;
+  //For each row
+  for (unsigned int r=0; r<size; r++) {
+    //For each column
+    for (unsigned int c=0; c<size; c++) {
+      //If this entry is on the diagonal
+      if (r==c) {
+        //Replace the entry with 1
+        write->elements[r][c] = 1;
+      } else {
+        //Replace the entry with 0
+        write->elements[r][c] = 0;
       }
     }
   }
@@ -742,7 +1641,4174 @@ bool mxSolveGauss(matrix *write, const matrix *transform, const matrix *result)
   return true;
 }
 
+//Adds the second matrix to the first
+bool mxAdd(matrix *write, const matrix *read1, const matrix *read2) {
+  //If the matrices can't be added
+  if (!( (read1->rows==read2->rows)&&(read1->columns==read2->columns) )) {return false;}
+
+  //Setting the size
+  write->rows = read1->rows;
+  write->columns = read1->columns;
+  //Add the elements (each element is read before it is written, so Write may be either matrix)
+  mxAddKernel(write->elements[0], MX_SIZE, read1->elements[0], MX_SIZE, read2->elements[0], MX_SIZE, read1->rows, read1->columns);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Scales/Multiplies the given matrix by a factor
+void mxScale(matrix *write, const matrix *read, double factor) {
+  //Setting the size
+  write->rows = read->rows;
+  write->columns = read->columns;
+  //Scale the elements
+  mxScaleKernel(write->elements[0], MX_SIZE, read->elements[0], MX_SIZE, read->rows, read->columns, factor);
+}
+
+//Scales/Multiplies the given matrix by a factor, in place
+void mxScale_inplace(matrix *write, double factor) {
+  //Scale the elements
+  mxScaleKernel(write->elements[0], MX_SIZE, write->elements[0], MX_SIZE, write->rows, write->columns, factor);
+}
+
+//Multiplies the matrices with a written-out function, if they are both square and of the same fixed size
+static bool mxMultiplyFixed(matrix *write, const matrix *read1, const matrix *read2) {
+  //If the matrices aren't both square and of the same size
+  if ((read1->rows!=read1->columns)||(read2->rows!=read2->columns)||(read1->rows!=read2->rows)) {return false;}
+
+  //Use the function for that size, if there is one
+  switch (read1->rows) {
+#if MX_SIZE>=2
+    case 2: mxMultiply2(write, read1, read2); return true;
+#endif
+#if MX_SIZE>=3
+    case 3: mxMultiply3(write, read1, read2); return true;
+#endif
+#if MX_SIZE>=4
+    case 4: mxMultiply4(write, read1, read2); return true;
+#endif
+    default: return false;
+  }
+}
+
+//Multiplies the matrices
+bool mxMultiply(matrix *write, const matrix *read1, const matrix *read2) {
+  //If the matrices can't be multiplied
+  if (read1->columns!=read2->rows) {return false;}
+  //If the matrices are a fixed size, the written-out multiplication is used (it doesn't need copies)
+  if (mxMultiplyFixed(write, read1, read2)) {return true;}
+
+  //If Write is one of the matrices being multiplied, temporarily store that matrix
+  matrix m;
+  if ((write==read1)||(write==read2)) {
+    mxCopy(&m, write);
+    if (write==read1) {read1 = &m;}
+    if (write==read2) {read2 = &m;}
+  }
+
+  //Multiply the elements
+  return mxMultiply_noalias(write, read1, read2);
+}
+
+//Multiplies the matrices, where Write is not one of the matrices being multiplied
+bool mxMultiply_noalias(matrix *MX_RESTRICT write, const matrix *MX_RESTRICT read1, const matrix *MX_RESTRICT read2) {
+  //If the matrices can't be multiplied
+  if (read1->columns!=read2->rows) {return false;}
+  //If the matrices are a fixed size, the written-out multiplication is used
+  if (mxMultiplyFixed(write, read1, read2)) {return true;}
+
+  //Setting the size
+  write->rows = read1->rows;
+  write->columns = read2->columns;
+  //Multiply the elements
+  mxGemmKernel(write->elements[0], MX_SIZE, 1, read1->elements[0], MX_SIZE, read2->elements[0], MX_SIZE, 0, read1->rows, read1->columns, read2->columns, __FIXED_PACK);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Multiplies two matrices, and accumulates them into a scaled Write
+bool mxGemm(matrix *write, double alpha, const matrix *read1, const matrix *read2, double beta) {
+  //If the matrices can't be multiplied
+  if (read1->columns!=read2->rows) {return false;}
+  //If Write is one of the matrices being multiplied
+  if ((write==read1)||(write==read2)) {return false;}
+  //If Write is being accumulated into, it must be the right size
+  if ((beta!=0)&&((write->rows!=read1->rows)||(write->columns!=read2->columns))) {return false;}
+
+  //Setting the size
+  write->rows = read1->rows;
+  write->columns = read2->columns;
+  //Multiply and accumulate the elements
+  mxGemmKernel(write->elements[0], MX_SIZE, alpha, read1->elements[0], MX_SIZE, read2->elements[0], MX_SIZE, beta, read1->rows, read1->columns, read2->columns, __FIXED_PACK);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Returns the determinant of the given matrix
+mxElement_t mxDeterminant(const matrix *read) {
+  //If it's not a square matrix
+  if (read->rows!=read->columns) {return __FAIL;}
+  //If there is only 1 element, return that element
+  if (read->rows==1) {return read->elements[0][0];}
+  //If the matrix is a fixed size, use the written-out determinant
+  switch (read->rows) {
+#if MX_SIZE>=2
+    case 2: return mxDeterminant2(read);
+#endif
+#if MX_SIZE>=3
+    case 3: return mxDeterminant3(read);
+#endif
+#if MX_SIZE>=4
+    case 4: return mxDeterminant4(read);
+#endif
+    default: break;
+  }
+
+#ifdef MX_EXACT
+  //Expand along the rows, through a view (so no minor is copied)
+  mxView view;
+  mxViewMatrix(&view, (matrix*)read);
+  return mxViewDeterminant(&view);
+#else
+  //Decompose the matrix
+  mxLUFactor factor;
+  //If the matrix is singular, the determinant is zero
+  if (!mxLU(&factor, read)) {return 0;}
+
+  //Return the value of the determinant
+  return mxLUDeterminant(&factor);
+#endif
+}
+
+//Transposes the given matrix
+void mxTranspose(matrix *write, const matrix *read) {
+  //If the matrix is square and a fixed size, use the written-out transpose
+  if (read->rows==read->columns) {
+    switch (read->rows) {
+#if MX_SIZE>=2
+      case 2: mxTranspose2(write, read); return;
+#endif
+#if MX_SIZE>=3
+      case 3: mxTranspose3(write, read); return;
+#endif
+#if MX_SIZE>=4
+      case 4: mxTranspose4(write, read); return;
+#endif
+      default: break;
+    }
+  }
+
+  //If Write is the same matrix, transpose it in place
+  if (write==read) {
+    mxTranspose_inplace(write);
+  } else {
+    mxTranspose_noalias(write, read);
+  }
+}
+
+//Transposes the given matrix, where Write is not the same matrix
+void mxTranspose_noalias(matrix *MX_RESTRICT write, const matrix *MX_RESTRICT read) {
+  //Transpose only the elements in the matrix, in cache-sized pieces
+  mxTransposeKernel(write->elements[0], MX_SIZE, read->elements[0], MX_SIZE, read->rows, read->columns);
+  //Swap the number of rows and columns
+  write->rows = read->columns;
+  write->columns = read->rows;
+}
+
+//Transposes the given matrix, in place
+void mxTranspose_inplace(matrix *write) {
+  //Swap the number of rows and columns
+  unsigned int rows = write->rows;
+  write->rows = write->columns;
+  write->columns = rows;
+  //Transpose the smallest square block of the storage that holds the matrix in place, in cache-sized pieces
+  mxTransposeSquareKernel(write->elements[0], MX_SIZE, (rows>write->rows)? rows:write->rows);
+}
+
+//Gets the adjoint of the given matrix
+bool mxAdjoint(matrix *write, const matrix *read) {
+  //If it's not a square matrix
+  if (read->rows!=read->columns) {return false;}
+
+  //If Write is the same matrix, temporarily store the Read matrix
+  matrix m;
+  if (write==read) {
+    mxCopy(&m, read);
+    read = &m;
+  }
+
+  //Setting the size
+  write->rows = read->rows;
+  write->columns = read->columns;
+
+  //A view of the matrix, and of each minor (which leaves out a row and column without copying)
+  mxView whole, minor;
+  mxViewMatrix(&whole, (matrix*)read);
+  //For each row
+  for (unsigned int r=0; r<read->rows; r++) {
+    //For each column
+    for (unsigned int c=0; c<read->columns; c++) {
+      //View the minor
+      mxViewMinor(&minor, &whole, r, c);
+
+      //Set the transposed element of the adjoint matrix
+      write->elements[c][r] = (((r+c)%2)? -1:1)*mxViewDeterminant(&minor);
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+#ifndef MX_EXACT
+//Inverts the given matrix using Gauss-Jordan elimination with partial pivoting (Write is left unchanged if it fails)
+static bool mxInverseGaussJordan(matrix *write, const matrix *read) {
+  //If it's not a square matrix
+  if (read->rows!=read->columns) {return false;}
+
+  //Copy the matrix, which is inverted in place (so Write is left unchanged if the inverse doesn't exist)
+  matrix m;
+  mxCopy(&m, read);
+
+  //Shorthand for the size and the elements
+  unsigned int n = m.rows;
+  mxElement_t (*a)[MX_SIZE] = m.elements;
+  //The row that was swapped with each pivot row
+  unsigned int swaps[MX_SIZE];
+
+  /* Gauss-Jordan elimination, where each column of the identity matrix
+  is built up in the column that was just eliminated (so no augmented matrix is needed) */
+  //For each column
+  for (unsigned int k=0; k<n; k++) {
+    //Search for the largest pivot on or below the diagonal
+    unsigned int p = k;
+    for (unsigned int r=k+1; r<n; r++) {
+      if (__ABS(a[r][k])>__ABS(a[p][k])) {p = r;}
+    }
+    //If there is no non-zero pivot, the inverse doesn't exist
+    if (a[p][k]==0) {return false;}
+
+    //Record and perform the row swap
+    swaps[k] = p;
+    if (p!=k) {
+      for (unsigned int c=0; c<n; c++) {
+        mxElement_t temp = a[k][c];
+        a[k][c] = a[p][c];
+        a[p][c] = temp;
+      }
+    }
+
+    //Divide the pivot row by the pivot (the pivot's position takes the identity's 1)
+    mxElement_t pivot = a[k][k];
+    a[k][k] = 1;
+    for (unsigned int c=0; c<n; c++) {a[k][c] /= pivot;}
+
+    //For each other row
+    for (unsigned int r=0; r<n; r++) {
+      //If this row isn't the pivot
+      if (r!=k) {
+        //Eliminate this column (the column's position takes the identity's 0)
+        mxElement_t scalar = a[r][k];
+        a[r][k] = 0;
+        for (unsigned int c=0; c<n; c++) {a[r][c] -= scalar*a[k][c];}
+      }
+    }
+  }
+
+  /* Undo the row swaps by swapping columns, in reverse order */
+  for (unsigned int k=n; k-->0;) {
+    //If a swap was made
+    if (swaps[k]!=k) {
+      //Swap the columns
+      for (unsigned int r=0; r<n; r++) {
+        mxElement_t temp = a[r][k];
+        a[r][k] = a[r][swaps[k]];
+        a[r][swaps[k]] = temp;
+      }
+    }
+  }
+
+  //Copy the inverse into Write
+  mxCopy(write, &m);
+
+  //Indicate that the process was successful
+  return true;
+}
+#endif
+
+//Inverts the given matrix
+bool mxInverse(matrix *write, const matrix *read) {
+#ifndef MX_EXACT
+  //If the matrix is square and a fixed size, use the written-out inverse
+  if (read->rows==read->columns) {
+    switch (read->rows) {
+#if MX_SIZE>=2
+      case 2: return mxInverse2(write, read);
+#endif
+#if MX_SIZE>=3
+      case 3: return mxInverse3(write, read);
+#endif
+#if MX_SIZE>=4
+      case 4: return mxInverse4(write, read);
+#endif
+      default: break;
+    }
+  }
+#endif
+
+#ifdef MX_EXACT
+  //Use the exact adjoint method, at every size
+  return mxInverse_adj(write, read);
+#else
+  //Use Gauss-Jordan elimination
+  return mxInverseGaussJordan(write, read);
+#endif
+}
+
+//Inverts the given matrix, using the adjoint and the determinant
+bool mxInverse_adj(matrix *write, const matrix *read) {
+  //If it's not a square matrix
+  if (read->rows!=read->columns) {return false;}
+  //Getting the determinant
+  mxElement_t det = mxDeterminant(read);
+  //If the determinant is zero, the inverse doesn't exist
+  if (det==0) {return false;}
+
+  //Set Write to the adjoint
+  mxAdjoint(write, read);
+  //Scale Write by dividing by the determinant
+  mxScale(write, write, 1/det);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Updates an inverse to the inverse of the matrix plus U*V', in O(n²k)
+bool mxInverseUpdate(matrix *write, const matrix *u, const matrix *v) {
+  //Shorthand for the size and the rank of the update
+  unsigned int n = write->rows;
+  unsigned int k = u->columns;
+  //If the inverse isn't square, or U and V are the wrong sizes
+  if ((write->columns!=n)||(u->rows!=n)||(v->rows!=n)||(v->columns!=k)||(n==0)||(k==0)) {return false;}
+
+  //Update the inverse in place, with workspace on the stack
+  mxElement_t work[2*n*k+k*k+k];
+  return mxWoodburyKernel(write->elements[0], MX_SIZE, n, u->elements[0], MX_SIZE, v->elements[0], MX_SIZE, k, work, __FIXED_PACK);
+}
+
+//Solves for a particular element within a particular vector using Cramer's rule
+mxElement_t mxSolveCramer(const matrix *transform, const matrix *result, int vector, int index) {
+  //If it's not a square matrix
+  if (transform->rows!=transform->columns) {return __FAIL;}
+  //If the vector number is out of bounds
+  if (vector>=result->columns) {return __FAIL;}
+  //If the index is out of bounds
+  if (index>=result->rows) {return __FAIL;}
+  //If the result is impossible from the transform
+  if (transform->rows!=result->rows) {return __FAIL;}
+
+#ifndef MX_EXACT
+  //Decompose the transform
+  mxLUFactor factor;
+  //If the transform is invertible
+  if (mxLU(&factor, transform)) {
+    //Memory for the vector
+    mxElement_t x[MX_SIZE];
+    //Permute the resulting vector into the order of the decomposition
+    for (unsigned int i=0; i<result->rows; i++) {x[i] = result->elements[factor.permutation[i]][vector];}
+    //Solve for the vector, which gives the same element as Cramer's Rule (newDet/det)
+    mxLUSubstitute(&factor, x);
+    return x[index];
+  }
+#endif
+
+  //Get the determinant of the transform
+  mxElement_t det = mxDeterminant(transform);
+  //Copy the transform
+  matrix m;
+  mxCopy(&m, transform);
+  //For each index in the resulting vector
+  for (unsigned int i=0; i<result->rows; i++) {
+    //Copy this entry to the new matrix
+    m.elements[i][index] = result->elements[i][vector];
+  }
+  //Get the determinant of the new matrix
+  mxElement_t newDet = mxDeterminant(&m);
+
+  //If there are infinite solutions
+  if ((det==0)&&(newDet==0)) {return __INF_SOLUTIONS;}
+  //If there are no solutions
+  if ((det==0)&&(newDet!=0)) {return __FAIL;}
+  //Otherwise, there is one solution, using Cramer's Rule
+  return (newDet/det);
+}
+
+//Solves for all vectors using the inverse of the transformation
+bool mxSolveInverse(matrix *write, const matrix *transform, const matrix *result) {
+  //Save Write as the inverse of the Transform
+  if (!mxInverse(write, transform)) {
+    //If this process __FAILs
+    return false;
+  }
+  //Save Write as the multiplication of the inverse and the result
+  mxMultiply(write, write, result);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Solves for all vectors of a symmetric positive-definite transformation, using its Cholesky decomposition
+bool mxSolveCholesky(matrix *write, const matrix *transform, const matrix *result) {
+  //Decompose the transform
+  matrix factor;
+  if (!mxCholesky(&factor, transform)) {return false;}
+  //Solve for the vectors
+  return mxCholeskySolve(write, &factor, result);
+}
+
+//Solves for all vectors of a symmetric transformation, using its LDL' decomposition
+bool mxSolveLDL(matrix *write, const matrix *transform, const matrix *result) {
+  //Decompose the transform
+  matrix factor;
+  if (!mxLDL(&factor, transform)) {return false;}
+  //Solve for the vectors
+  return mxLDLSolve(write, &factor, result);
+}
+
+//Solves for all vectors in the least-squares sense, for a transformation with at least as many rows as columns
+bool mxSolveLeastSquares(matrix *write, const matrix *transform, const matrix *result) {
+  //Decompose the transform
+  mxQRFactor factor;
+  if (!mxQR(&factor, transform)) {return false;}
+  //Solve for the vectors
+  return mxQRSolve(write, &factor, result);
+}
+
+//Turns a matrix into Reduced Row Echelon Form, and edits 1 additional matrix as collateral
+void mxReducedEchelon_coll(matrix *writeReduce, matrix *writeCollateral, const matrix *readReduce, const matrix *readCollateral) {
+  //Copy the matrices
+  mxCopy(writeReduce, readReduce);
+  mxCopy(writeCollateral, readCollateral);
+
+  //Reduce the copies in place, then put the rows in order
+  unsigned int order[MX_SIZE];
+  mxReduceKernel(writeReduce->elements[0], MX_SIZE, writeReduce->rows, writeReduce->columns, writeCollateral->elements[0], MX_SIZE, writeCollateral->columns, order);
+  mxReorderRows(writeReduce->elements[0], MX_SIZE, writeReduce->rows, writeReduce->columns, writeCollateral->elements[0], MX_SIZE, writeCollateral->columns, order);
+}
+
+//Turns a matrix into Reduced Row Echelon Form
+void mxReducedEchelon(matrix *write, const matrix *read) {
+  //Creating a zero matrix
+  matrix zero;
+  mxZero(&zero);
+
+  //Turning the matrix into Reduced Row Echelon Form
+  mxReducedEchelon_coll(write, &zero, read, &zero);
+}
+
+//Solves for all vectors where possible, using Guass reduction
+bool mxSolveGauss(matrix *write, const matrix *transform, const matrix *result) {
+  //If the result is impossible from the transform
+  if (transform->rows!=result->rows) {return false;}
+
+  //Set the size
+  write->rows = transform->columns;
+  write->columns = result->columns;
+
+  //Creating new matrices to do row operations on
+  matrix transform0;
+  matrix result0;
+
+  //Gauss Reduction (each row is solved on its own, so the rows are left out of order)
+  mxCopy(&transform0, transform);
+  mxCopy(&result0, result);
+  unsigned int order[MX_SIZE];
+  mxReduceKernel(transform0.elements[0], MX_SIZE, transform0.rows, transform0.columns, result0.elements[0], MX_SIZE, result0.columns, order);
+
+  /* To solve for the vectors, we're going to make all free variables equal 0,
+  and only pivots will have a non-zero value */
+  //Whether a variable has been solved for or not
+  bool solved[transform0.columns];
+  //Note that none of the variables have been solved for
+  for (unsigned int i=0; i<transform0.columns; i++) {solved[i] = 0;}
+  //For each row in the transformation
+  for (unsigned int r=0; r<transform0.rows; r++) {
+    //Start with the first column
+    int c=0;
+    //Search for the pivot, left to right
+    while ((transform0.elements[r][c]==0)&&(c+1<transform0.columns)) {c++;}
+    //For each output vector
+    for (unsigned int v=0; v<result0.columns; v++) {
+      //If no pivot was found
+      if (transform0.elements[r][c]==0) {
+        //If the result is non-zero
+        if (result0.elements[r][v]!=0) {
+          //Then there is no possible solution
+          return false;
+        }
+      } else {
+        //Solve for the pivot-variable
+        write->elements[c][v] = result0.elements[r][v]/transform0.elements[r][c];
+        //Note that the variable has been solved for
+        solved[c] = 1;
+      }
+    }
+  }
+  //For each variable
+  for (unsigned int i=0; i<transform0.columns; i++) {
+    //If this variable was not solved for
+    if (!solved[i]) {
+      //For each vector
+      for (unsigned int v=0; v<result0.columns; v++) {
+        //Set the solution to 0
+        write->elements[i][v] = 0;
+      }
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+/*================================*/
+/* FIXED SIZES ================================*/
+
+/* The following functions are written out in full for one size, so they run without loops, recursion or copies.
+They don't check the sizes of the matrices they read, and Write may be one of the matrices being read
+(all the elements are read before any are written) */
+
+#if MX_SIZE>=2
+//Multiplies two 2x2 matrices
+void mxMultiply2(matrix *write, const matrix *read1, const matrix *read2) {
+  //Shorthand for the elements
+  const mxElement_t (*a)[MX_SIZE] = read1->elements;
+  const mxElement_t (*b)[MX_SIZE] = read2->elements;
+
+  //Calculate each element
+  mxElement_t m[2][2];
+  m[0][0] = a[0][0]*b[0][0] + a[0][1]*b[1][0];
+  m[0][1] = a[0][0]*b[0][1] + a[0][1]*b[1][1];
+  m[1][0] = a[1][0]*b[0][0] + a[1][1]*b[1][0];
+  m[1][1] = a[1][0]*b[0][1] + a[1][1]*b[1][1];
+
+  //Write the result
+  write->rows = 2;
+  write->columns = 2;
+  write->elements[0][0] = m[0][0]; write->elements[0][1] = m[0][1];
+  write->elements[1][0] = m[1][0]; write->elements[1][1] = m[1][1];
+}
+
+//Returns the determinant of a 2x2 matrix
+mxElement_t mxDeterminant2(const matrix *read) {
+  //Shorthand for the elements
+  const mxElement_t (*a)[MX_SIZE] = read->elements;
+  //Return the difference of the diagonal products
+  return a[0][0]*a[1][1] - a[0][1]*a[1][0];
+}
+
+//Inverts a 2x2 matrix
+bool mxInverse2(matrix *write, const matrix *read) {
+  //Shorthand for the elements
+  const mxElement_t (*a)[MX_SIZE] = read->elements;
+
+  //Getting the determinant
+  mxElement_t det = a[0][0]*a[1][1] - a[0][1]*a[1][0];
+  //If the determinant is zero, the inverse doesn't exist
+  if (det==0) {return false;}
+  mxElement_t reciprocal = 1/det;
+
+  //Calculate each element of the adjoint, divided by the determinant
+  mxElement_t m[2][2];
+  m[0][0] = a[1][1]*reciprocal;
+  m[0][1] = -a[0][1]*reciprocal;
+  m[1][0] = -a[1][0]*reciprocal;
+  m[1][1] = a[0][0]*reciprocal;
+
+  //Write the result
+  write->rows = 2;
+  write->columns = 2;
+  write->elements[0][0] = m[0][0]; write->elements[0][1] = m[0][1];
+  write->elements[1][0] = m[1][0]; write->elements[1][1] = m[1][1];
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Transposes a 2x2 matrix
+void mxTranspose2(matrix *write, const matrix *read) {
+  //Shorthand for the elements
+  const mxElement_t (*a)[MX_SIZE] = read->elements;
+
+  //Read the elements in their transposed positions
+  mxElement_t m[2][2];
+  m[0][0] = a[0][0]; m[0][1] = a[1][0];
+  m[1][0] = a[0][1]; m[1][1] = a[1][1];
+
+  //Write the result
+  write->rows = 2;
+  write->columns = 2;
+  write->elements[0][0] = m[0][0]; write->elements[0][1] = m[0][1];
+  write->elements[1][0] = m[1][0]; write->elements[1][1] = m[1][1];
+}
+#endif
+
+#if MX_SIZE>=3
+//Multiplies two 3x3 matrices
+void mxMultiply3(matrix *write, const matrix *read1, const matrix *read2) {
+  //Shorthand for the elements
+  const mxElement_t (*a)[MX_SIZE] = read1->elements;
+  const mxElement_t (*b)[MX_SIZE] = read2->elements;
+
+  //Calculate each element
+  mxElement_t m[3][3];
+  m[0][0] = a[0][0]*b[0][0] + a[0][1]*b[1][0] + a[0][2]*b[2][0];
+  m[0][1] = a[0][0]*b[0][1] + a[0][1]*b[1][1] + a[0][2]*b[2][1];
+  m[0][2] = a[0][0]*b[0][2] + a[0][1]*b[1][2] + a[0][2]*b[2][2];
+  m[1][0] = a[1][0]*b[0][0] + a[1][1]*b[1][0] + a[1][2]*b[2][0];
+  m[1][1] = a[1][0]*b[0][1] + a[1][1]*b[1][1] + a[1][2]*b[2][1];
+  m[1][2] = a[1][0]*b[0][2] + a[1][1]*b[1][2] + a[1][2]*b[2][2];
+  m[2][0] = a[2][0]*b[0][0] + a[2][1]*b[1][0] + a[2][2]*b[2][0];
+  m[2][1] = a[2][0]*b[0][1] + a[2][1]*b[1][1] + a[2][2]*b[2][1];
+  m[2][2] = a[2][0]*b[0][2] + a[2][1]*b[1][2] + a[2][2]*b[2][2];
+
+  //Write the result
+  write->rows = 3;
+  write->columns = 3;
+  write->elements[0][0] = m[0][0]; write->elements[0][1] = m[0][1]; write->elements[0][2] = m[0][2];
+  write->elements[1][0] = m[1][0]; write->elements[1][1] = m[1][1]; write->elements[1][2] = m[1][2];
+  write->elements[2][0] = m[2][0]; write->elements[2][1] = m[2][1]; write->elements[2][2] = m[2][2];
+}
+
+//Returns the determinant of a 3x3 matrix
+mxElement_t mxDeterminant3(const matrix *read) {
+  //Shorthand for the elements
+  const mxElement_t (*a)[MX_SIZE] = read->elements;
+  //Expand along the first row
+  return a[0][0]*(a[1][1]*a[2][2] - a[1][2]*a[2][1])
+       - a[0][1]*(a[1][0]*a[2][2] - a[1][2]*a[2][0])
+       + a[0][2]*(a[1][0]*a[2][1] - a[1][1]*a[2][0]);
+}
+
+//Inverts a 3x3 matrix
+bool mxInverse3(matrix *write, const matrix *read) {
+  //Shorthand for the elements
+  const mxElement_t (*a)[MX_SIZE] = read->elements;
+
+  //Getting the cofactors of the first column, and then the determinant
+  mxElement_t c00 = a[1][1]*a[2][2] - a[1][2]*a[2][1];
+  mxElement_t c10 = a[1][2]*a[2][0] - a[1][0]*a[2][2];
+  mxElement_t c20 = a[1][0]*a[2][1] - a[1][1]*a[2][0];
+  mxElement_t det = a[0][0]*c00 + a[0][1]*c10 + a[0][2]*c20;
+  //If the determinant is zero, the inverse doesn't exist
+  if (det==0) {return false;}
+  mxElement_t reciprocal = 1/det;
+
+  //Calculate each element of the adjoint, divided by the determinant
+  mxElement_t m[3][3];
+  m[0][0] = c00*reciprocal;
+  m[0][1] = (a[0][2]*a[2][1] - a[0][1]*a[2][2])*reciprocal;
+  m[0][2] = (a[0][1]*a[1][2] - a[0][2]*a[1][1])*reciprocal;
+  m[1][0] = c10*reciprocal;
+  m[1][1] = (a[0][0]*a[2][2] - a[0][2]*a[2][0])*reciprocal;
+  m[1][2] = (a[0][2]*a[1][0] - a[0][0]*a[1][2])*reciprocal;
+  m[2][0] = c20*reciprocal;
+  m[2][1] = (a[0][1]*a[2][0] - a[0][0]*a[2][1])*reciprocal;
+  m[2][2] = (a[0][0]*a[1][1] - a[0][1]*a[1][0])*reciprocal;
+
+  //Write the result
+  write->rows = 3;
+  write->columns = 3;
+  write->elements[0][0] = m[0][0]; write->elements[0][1] = m[0][1]; write->elements[0][2] = m[0][2];
+  write->elements[1][0] = m[1][0]; write->elements[1][1] = m[1][1]; write->elements[1][2] = m[1][2];
+  write->elements[2][0] = m[2][0]; write->elements[2][1] = m[2][1]; write->elements[2][2] = m[2][2];
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Transposes a 3x3 matrix
+void mxTranspose3(matrix *write, const matrix *read) {
+  //Shorthand for the elements
+  const mxElement_t (*a)[MX_SIZE] = read->elements;
+
+  //Read the elements in their transposed positions
+  mxElement_t m[3][3];
+  m[0][0] = a[0][0]; m[0][1] = a[1][0]; m[0][2] = a[2][0];
+  m[1][0] = a[0][1]; m[1][1] = a[1][1]; m[1][2] = a[2][1];
+  m[2][0] = a[0][2]; m[2][1] = a[1][2]; m[2][2] = a[2][2];
+
+  //Write the result
+  write->rows = 3;
+  write->columns = 3;
+  write->elements[0][0] = m[0][0]; write->elements[0][1] = m[0][1]; write->elements[0][2] = m[0][2];
+  write->elements[1][0] = m[1][0]; write->elements[1][1] = m[1][1]; write->elements[1][2] = m[1][2];
+  write->elements[2][0] = m[2][0]; write->elements[2][1] = m[2][1]; write->elements[2][2] = m[2][2];
+}
+#endif
+
+#if MX_SIZE>=4
+//Multiplies two 4x4 matrices
+void mxMultiply4(matrix *write, const matrix *read1, const matrix *read2) {
+  //Shorthand for the elements
+  const mxElement_t (*a)[MX_SIZE] = read1->elements;
+  const mxElement_t (*b)[MX_SIZE] = read2->elements;
+
+  //Calculate each element
+  mxElement_t m[4][4];
+  m[0][0] = a[0][0]*b[0][0] + a[0][1]*b[1][0] + a[0][2]*b[2][0] + a[0][3]*b[3][0];
+  m[0][1] = a[0][0]*b[0][1] + a[0][1]*b[1][1] + a[0][2]*b[2][1] + a[0][3]*b[3][1];
+  m[0][2] = a[0][0]*b[0][2] + a[0][1]*b[1][2] + a[0][2]*b[2][2] + a[0][3]*b[3][2];
+  m[0][3] = a[0][0]*b[0][3] + a[0][1]*b[1][3] + a[0][2]*b[2][3] + a[0][3]*b[3][3];
+  m[1][0] = a[1][0]*b[0][0] + a[1][1]*b[1][0] + a[1][2]*b[2][0] + a[1][3]*b[3][0];
+  m[1][1] = a[1][0]*b[0][1] + a[1][1]*b[1][1] + a[1][2]*b[2][1] + a[1][3]*b[3][1];
+  m[1][2] = a[1][0]*b[0][2] + a[1][1]*b[1][2] + a[1][2]*b[2][2] + a[1][3]*b[3][2];
+  m[1][3] = a[1][0]*b[0][3] + a[1][1]*b[1][3] + a[1][2]*b[2][3] + a[1][3]*b[3][3];
+  m[2][0] = a[2][0]*b[0][0] + a[2][1]*b[1][0] + a[2][2]*b[2][0] + a[2][3]*b[3][0];
+  m[2][1] = a[2][0]*b[0][1] + a[2][1]*b[1][1] + a[2][2]*b[2][1] + a[2][3]*b[3][1];
+  m[2][2] = a[2][0]*b[0][2] + a[2][1]*b[1][2] + a[2][2]*b[2][2] + a[2][3]*b[3][2];
+  m[2][3] = a[2][0]*b[0][3] + a[2][1]*b[1][3] + a[2][2]*b[2][3] + a[2][3]*b[3][3];
+  m[3][0] = a[3][0]*b[0][0] + a[3][1]*b[1][0] + a[3][2]*b[2][0] + a[3][3]*b[3][0];
+  m[3][1] = a[3][0]*b[0][1] + a[3][1]*b[1][1] + a[3][2]*b[2][1] + a[3][3]*b[3][1];
+  m[3][2] = a[3][0]*b[0][2] + a[3][1]*b[1][2] + a[3][2]*b[2][2] + a[3][3]*b[3][2];
+  m[3][3] = a[3][0]*b[0][3] + a[3][1]*b[1][3] + a[3][2]*b[2][3] + a[3][3]*b[3][3];
+
+  //Write the result
+  write->rows = 4;
+  write->columns = 4;
+  write->elements[0][0] = m[0][0]; write->elements[0][1] = m[0][1]; write->elements[0][2] = m[0][2]; write->elements[0][3] = m[0][3];
+  write->elements[1][0] = m[1][0]; write->elements[1][1] = m[1][1]; write->elements[1][2] = m[1][2]; write->elements[1][3] = m[1][3];
+  write->elements[2][0] = m[2][0]; write->elements[2][1] = m[2][1]; write->elements[2][2] = m[2][2]; write->elements[2][3] = m[2][3];
+  write->elements[3][0] = m[3][0]; write->elements[3][1] = m[3][1]; write->elements[3][2] = m[3][2]; write->elements[3][3] = m[3][3];
+}
+
+//Returns the determinant of a 4x4 matrix
+mxElement_t mxDeterminant4(const matrix *read) {
+  //Shorthand for the elements
+  const mxElement_t (*a)[MX_SIZE] = read->elements;
+
+  //Getting the 2x2 determinants from the top two rows, and from the bottom two rows
+  mxElement_t s0 = a[0][0]*a[1][1] - a[1][0]*a[0][1];
+  mxElement_t s1 = a[0][0]*a[1][2] - a[1][0]*a[0][2];
+  mxElement_t s2 = a[0][0]*a[1][3] - a[1][0]*a[0][3];
+  mxElement_t s3 = a[0][1]*a[1][2] - a[1][1]*a[0][2];
+  mxElement_t s4 = a[0][1]*a[1][3] - a[1][1]*a[0][3];
+  mxElement_t s5 = a[0][2]*a[1][3] - a[1][2]*a[0][3];
+  mxElement_t c5 = a[2][2]*a[3][3] - a[3][2]*a[2][3];
+  mxElement_t c4 = a[2][1]*a[3][3] - a[3][1]*a[2][3];
+  mxElement_t c3 = a[2][1]*a[3][2] - a[3][1]*a[2][2];
+  mxElement_t c2 = a[2][0]*a[3][3] - a[3][0]*a[2][3];
+  mxElement_t c1 = a[2][0]*a[3][2] - a[3][0]*a[2][2];
+  mxElement_t c0 = a[2][0]*a[3][1] - a[3][0]*a[2][1];
+
+  //Combine the complementary pairs (Laplace expansion along the top two rows)
+  return s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+}
+
+//Inverts a 4x4 matrix
+bool mxInverse4(matrix *write, const matrix *read) {
+  //Shorthand for the elements
+  const mxElement_t (*a)[MX_SIZE] = read->elements;
+
+  //Getting the 2x2 determinants from the top two rows, and from the bottom two rows
+  mxElement_t s0 = a[0][0]*a[1][1] - a[1][0]*a[0][1];
+  mxElement_t s1 = a[0][0]*a[1][2] - a[1][0]*a[0][2];
+  mxElement_t s2 = a[0][0]*a[1][3] - a[1][0]*a[0][3];
+  mxElement_t s3 = a[0][1]*a[1][2] - a[1][1]*a[0][2];
+  mxElement_t s4 = a[0][1]*a[1][3] - a[1][1]*a[0][3];
+  mxElement_t s5 = a[0][2]*a[1][3] - a[1][2]*a[0][3];
+  mxElement_t c5 = a[2][2]*a[3][3] - a[3][2]*a[2][3];
+  mxElement_t c4 = a[2][1]*a[3][3] - a[3][1]*a[2][3];
+  mxElement_t c3 = a[2][1]*a[3][2] - a[3][1]*a[2][2];
+  mxElement_t c2 = a[2][0]*a[3][3] - a[3][0]*a[2][3];
+  mxElement_t c1 = a[2][0]*a[3][2] - a[3][0]*a[2][2];
+  mxElement_t c0 = a[2][0]*a[3][1] - a[3][0]*a[2][1];
+
+  //Getting the determinant
+  mxElement_t det = s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+  //If the determinant is zero, the inverse doesn't exist
+  if (det==0) {return false;}
+  mxElement_t reciprocal = 1/det;
+
+  //Calculate each element of the adjoint, divided by the determinant
+  mxElement_t m[4][4];
+  m[0][0] = ( a[1][1]*c5 - a[1][2]*c4 + a[1][3]*c3)*reciprocal;
+  m[0][1] = (-a[0][1]*c5 + a[0][2]*c4 - a[0][3]*c3)*reciprocal;
+  m[0][2] = ( a[3][1]*s5 - a[3][2]*s4 + a[3][3]*s3)*reciprocal;
+  m[0][3] = (-a[2][1]*s5 + a[2][2]*s4 - a[2][3]*s3)*reciprocal;
+  m[1][0] = (-a[1][0]*c5 + a[1][2]*c2 - a[1][3]*c1)*reciprocal;
+  m[1][1] = ( a[0][0]*c5 - a[0][2]*c2 + a[0][3]*c1)*reciprocal;
+  m[1][2] = (-a[3][0]*s5 + a[3][2]*s2 - a[3][3]*s1)*reciprocal;
+  m[1][3] = ( a[2][0]*s5 - a[2][2]*s2 + a[2][3]*s1)*reciprocal;
+  m[2][0] = ( a[1][0]*c4 - a[1][1]*c2 + a[1][3]*c0)*reciprocal;
+  m[2][1] = (-a[0][0]*c4 + a[0][1]*c2 - a[0][3]*c0)*reciprocal;
+  m[2][2] = ( a[3][0]*s4 - a[3][1]*s2 + a[3][3]*s0)*reciprocal;
+  m[2][3] = (-a[2][0]*s4 + a[2][1]*s2 - a[2][3]*s0)*reciprocal;
+  m[3][0] = (-a[1][0]*c3 + a[1][1]*c1 - a[1][2]*c0)*reciprocal;
+  m[3][1] = ( a[0][0]*c3 - a[0][1]*c1 + a[0][2]*c0)*reciprocal;
+  m[3][2] = (-a[3][0]*s3 + a[3][1]*s1 - a[3][2]*s0)*reciprocal;
+  m[3][3] = ( a[2][0]*s3 - a[2][1]*s1 + a[2][2]*s0)*reciprocal;
+
+  //Write the result
+  write->rows = 4;
+  write->columns = 4;
+  write->elements[0][0] = m[0][0]; write->elements[0][1] = m[0][1]; write->elements[0][2] = m[0][2]; write->elements[0][3] = m[0][3];
+  write->elements[1][0] = m[1][0]; write->elements[1][1] = m[1][1]; write->elements[1][2] = m[1][2]; write->elements[1][3] = m[1][3];
+  write->elements[2][0] = m[2][0]; write->elements[2][1] = m[2][1]; write->elements[2][2] = m[2][2]; write->elements[2][3] = m[2][3];
+  write->elements[3][0] = m[3][0]; write->elements[3][1] = m[3][1]; write->elements[3][2] = m[3][2]; write->elements[3][3] = m[3][3];
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Transposes a 4x4 matrix
+void mxTranspose4(matrix *write, const matrix *read) {
+  //Shorthand for the elements
+  const mxElement_t (*a)[MX_SIZE] = read->elements;
+
+  //Read the elements in their transposed positions
+  mxElement_t m[4][4];
+  m[0][0] = a[0][0]; m[0][1] = a[1][0]; m[0][2] = a[2][0]; m[0][3] = a[3][0];
+  m[1][0] = a[0][1]; m[1][1] = a[1][1]; m[1][2] = a[2][1]; m[1][3] = a[3][1];
+  m[2][0] = a[0][2]; m[2][1] = a[1][2]; m[2][2] = a[2][2]; m[2][3] = a[3][2];
+  m[3][0] = a[0][3]; m[3][1] = a[1][3]; m[3][2] = a[2][3]; m[3][3] = a[3][3];
+
+  //Write the result
+  write->rows = 4;
+  write->columns = 4;
+  write->elements[0][0] = m[0][0]; write->elements[0][1] = m[0][1]; write->elements[0][2] = m[0][2]; write->elements[0][3] = m[0][3];
+  write->elements[1][0] = m[1][0]; write->elements[1][1] = m[1][1]; write->elements[1][2] = m[1][2]; write->elements[1][3] = m[1][3];
+  write->elements[2][0] = m[2][0]; write->elements[2][1] = m[2][1]; write->elements[2][2] = m[2][2]; write->elements[2][3] = m[2][3];
+  write->elements[3][0] = m[3][0]; write->elements[3][1] = m[3][1]; write->elements[3][2] = m[3][2]; write->elements[3][3] = m[3][3];
+}
+#endif
+
+/*================================*/
+/* DECOMPOSITIONS ================================*/
+
+//Decomposes a square matrix into lower and upper triangular matrices, using partial pivoting
+bool mxLU(mxLUFactor *write, const matrix *read) {
+  //If it's not a square matrix
+  if (read->rows!=read->columns) {return false;}
+
+  //Copy the matrix, which will be decomposed in place
+  mxCopy(&write->lu, read);
+  //Start with no row swaps, and not yet usable
+  write->valid = false;
+  write->sign = 1;
+  for (unsigned int r=0; r<read->rows; r++) {write->permutation[r] = r;}
+  //Whether the matrix was found to be singular
+  bool singular = false;
+
+  //Shorthand for the size and the elements
+  unsigned int n = read->rows;
+  mxElement_t (*a)[MX_SIZE] = write->lu.elements;
+  //For each column
+  for (unsigned int k=0; k<n; k++) {
+    /* Partial pivoting: pick the largest entry on or below the diagonal */
+    unsigned int p = k;
+    mxElement_t largest = __ABS(a[k][k]);
+    //For each row below the diagonal
+    for (unsigned int r=k+1; r<n; r++) {
+      //If this entry is larger
+      if (__ABS(a[r][k])>largest) {
+        //Note it as the new pivot
+        largest = __ABS(a[r][k]);
+        p = r;
+      }
+    }
+    //If there is no non-zero pivot, the matrix is singular
+    if (largest==0) {
+      singular = true;
+      continue;
+    }
+
+    //If the pivot isn't on the diagonal
+    if (p!=k) {
+      //Swap the rows
+      for (unsigned int c=0; c<n; c++) {
+        mxElement_t temp = a[k][c];
+        a[k][c] = a[p][c];
+        a[p][c] = temp;
+      }
+      //Record the swap
+      unsigned int temp = write->permutation[k];
+      write->permutation[k] = write->permutation[p];
+      write->permutation[p] = temp;
+      write->sign = -write->sign;
+    }
+
+    /* Eliminate below the pivot */
+    //For each row below the pivot
+    for (unsigned int r=k+1; r<n; r++) {
+      //Store the multiplier in the lower triangle
+      a[r][k] /= a[k][k];
+      mxElement_t scalar = a[r][k];
+      //Decrease the rest of the row by the multiple of the pivot row
+      for (unsigned int c=k+1; c<n; c++) {a[r][c] -= scalar*a[k][c];}
+    }
+  }
+
+  //The decomposition can be used to solve, if the matrix isn't singular
+  write->valid = !singular;
+
+  //Indicate whether the process was successful
+  return !singular;
+}
+
+//Solves for all vectors, using a decomposition of the transformation matrix
+bool mxLUSolve(matrix *write, const mxLUFactor *factor, const matrix *result) {
+  //If the decomposition can't be used
+  if (!factor->valid) {return false;}
+  //If the result is impossible from the transform
+  if (factor->lu.rows!=result->rows) {return false;}
+
+  //Setting the size
+  unsigned int n = result->rows;
+  unsigned int columns = result->columns;
+  write->rows = n;
+  write->columns = columns;
+
+  //Memory for the vector
+  mxElement_t x[MX_SIZE];
+  //For each vector
+  for (unsigned int v=0; v<columns; v++) {
+    //Permute the resulting vector into the order of the decomposition
+    for (unsigned int i=0; i<n; i++) {x[i] = result->elements[factor->permutation[i]][v];}
+    //Solve for the vector with forward and backward substitution
+    mxLUSubstitute(factor, x);
+    //Copy the solution into Write (Result was fully read first, so Write may be the same matrix)
+    for (unsigned int i=0; i<n; i++) {write->elements[i][v] = x[i];}
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Marks a decomposition as out of date
+void mxLUInvalidate(mxLUFactor *write) {
+  write->valid = false;
+}
+
+//Decomposes the matrix again, only if the decomposition was marked as out of date
+bool mxLUUpdate(mxLUFactor *write, const matrix *read) {
+  //If the decomposition is still up to date, there's nothing to do
+  if (write->valid) {return true;}
+  //Otherwise, decompose the matrix
+  return mxLU(write, read);
+}
+
+//Solves for all vectors using a decomposition, then refines each solution with residuals found in double precision
+bool mxLUSolveRefined(matrix *write, const mxLUFactor *factor, const matrix *transform, const matrix *result, mxRefineReport *report) {
+  //If the decomposition can't be used
+  if (!factor->valid) {return false;}
+  //If the transform isn't the size that was decomposed, or the result is impossible from the transform
+  if ((transform->rows!=factor->lu.rows)||(transform->columns!=factor->lu.rows)||(result->rows!=factor->lu.rows)) {return false;}
+
+  //Shorthand for the size
+  unsigned int n = result->rows;
+  unsigned int columns = result->columns;
+  //What will be reported
+  unsigned int iterations = 0;
+  double relativeResidual = 0;
+  bool allConverged = true;
+
+  //The largest row sum of the transform, for the convergence test
+  double transformNorm = 0;
+  for (unsigned int i=0; i<n; i++) {
+    double sum = 0;
+    for (unsigned int j=0; j<n; j++) {sum += fabs((double)transform->elements[i][j]);}
+    if (sum>transformNorm) {transformNorm = sum;}
+  }
+
+  //Memory for the solution and the residual (in double), and for the vector being solved (in the element type)
+  double solution[MX_SIZE];
+  double r[MX_SIZE];
+  mxElement_t x[MX_SIZE];
+  //For each vector
+  for (unsigned int v=0; v<columns; v++) {
+    /* Solve in the element type, then keep the solution in double */
+    for (unsigned int i=0; i<n; i++) {x[i] = result->elements[factor->permutation[i]][v];}
+    mxLUSubstitute(factor, x);
+    for (unsigned int i=0; i<n; i++) {solution[i] = x[i];}
+    //The largest entry of the result, to make the residual relative
+    double resultNorm = 0;
+    for (unsigned int i=0; i<n; i++) {if (fabs((double)result->elements[i][v])>resultNorm) {resultNorm = fabs((double)result->elements[i][v]);}}
+
+    /* Refine the solution, until the residual is at the level of double rounding or the correction stops shrinking */
+    unsigned int steps = 0;
+    double previous = HUGE_VAL;
+    bool converged = false;
+    double residualNorm;
+    while (true) {
+      //Find the residual in double, result-transform*solution
+      residualNorm = 0;
+      for (unsigned int i=0; i<n; i++) {
+        double sum = result->elements[i][v];
+        for (unsigned int j=0; j<n; j++) {sum -= (double)transform->elements[i][j]*solution[j];}
+        r[i] = sum;
+        if (fabs(sum)>residualNorm) {residualNorm = fabs(sum);}
+      }
+      //The largest entry of the solution
+      double size = 0;
+      for (unsigned int i=0; i<n; i++) {if (fabs(solution[i])>size) {size = fabs(solution[i]);}}
+      //If the residual is as small as double rounding allows, the solution has converged
+      if (residualNorm<=sqrt((double)n)*DBL_EPSILON*transformNorm*size) {converged = true;}
+      //If refining is finished
+      if (converged||(steps==MX_REFINE_STEPS)) {break;}
+
+      //Solve for the correction in the element type (scaled, so small residuals don't underflow in float)
+      for (unsigned int i=0; i<n; i++) {x[i] = (mxElement_t)(r[factor->permutation[i]]/residualNorm);}
+      mxLUSubstitute(factor, x);
+      //The size of the correction
+      double correction = 0;
+      for (unsigned int i=0; i<n; i++) {if (fabs((double)x[i]*residualNorm)>correction) {correction = fabs((double)x[i]*residualNorm);}}
+      //If the correction isn't shrinking (the matrix is too ill-conditioned for the element type), keep the solution as it is
+      if (!(correction<previous)) {break;}
+      //Apply the correction
+      for (unsigned int i=0; i<n; i++) {solution[i] += (double)x[i]*residualNorm;}
+      steps++;
+      previous = correction;
+    }
+
+    //Round the solution into Write (this vector of Result was fully read first, so Write may be the same matrix)
+    for (unsigned int i=0; i<n; i++) {write->elements[i][v] = (mxElement_t)solution[i];}
+    //Keep the solution in double, if there's a report
+    if (report!=0) {
+      for (unsigned int i=0; i<n; i++) {report->solution[i][v] = solution[i];}
+    }
+    //Add this vector to what will be reported
+    if (steps>iterations) {iterations = steps;}
+    if ((resultNorm>0)&&(residualNorm/resultNorm>relativeResidual)) {relativeResidual = residualNorm/resultNorm;}
+    if (!converged) {allConverged = false;}
+  }
+
+  //Set the size of Write
+  write->rows = n;
+  write->columns = columns;
+  //Report back
+  if (report!=0) {
+    report->iterations = iterations;
+    report->residual = relativeResidual;
+    report->converged = allConverged;
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Solves for all vectors with mixed precision
+bool mxSolveRefined(matrix *write, const matrix *transform, const matrix *result, mxRefineReport *report) {
+  //Decompose the transform in the element type
+  mxLUFactor factor;
+  if (!mxLU(&factor, transform)) {return false;}
+  //Solve and refine
+  return mxLUSolveRefined(write, &factor, transform, result, report);
+}
+
+//Decomposes a symmetric positive-definite matrix into a lower triangular matrix L, where L*L' is the matrix
+bool mxCholesky(matrix *write, const matrix *read) {
+  //If it's not a square matrix
+  if (read->rows!=read->columns) {return false;}
+
+  //Copy the matrix, which is decomposed in place (so Write is left unchanged if the decomposition doesn't exist)
+  matrix m;
+  mxCopy(&m, read);
+
+  //Shorthand for the size and the elements
+  unsigned int n = m.rows;
+  mxElement_t (*a)[MX_SIZE] = m.elements;
+  /* Column by column, using only the lower triangle (each entry is read before it's replaced) */
+  //For each column
+  for (unsigned int j=0; j<n; j++) {
+    //Get the diagonal entry, less the squares of the row so far
+    mxElement_t diagonal = a[j][j];
+    for (unsigned int k=0; k<j; k++) {diagonal -= a[j][k]*a[j][k];}
+    //If the matrix isn't positive-definite
+    if (!(diagonal>0)) {return false;}
+    a[j][j] = sqrt(diagonal);
+
+    //For each row below the diagonal
+    for (unsigned int i=j+1; i<n; i++) {
+      //Get the entry, less the products of the two rows so far
+      mxElement_t entry = a[i][j];
+      for (unsigned int k=0; k<j; k++) {entry -= a[i][k]*a[j][k];}
+      a[i][j] = entry/a[j][j];
+    }
+  }
+  //Clear the upper triangle
+  for (unsigned int r=0; r<n; r++) {
+    for (unsigned int c=r+1; c<n; c++) {a[r][c] = 0;}
+  }
+  //Copy the decomposition into Write
+  mxCopy(write, &m);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Solves for all vectors, using a Cholesky decomposition of the transformation matrix
+bool mxCholeskySolve(matrix *write, const matrix *factor, const matrix *result) {
+  //If the result is impossible from the transform
+  if ((factor->rows!=factor->columns)||(factor->rows!=result->rows)) {return false;}
+
+  //Shorthand for the size and the elements
+  unsigned int n = result->rows;
+  unsigned int columns = result->columns;
+  const mxElement_t (*l)[MX_SIZE] = factor->elements;
+  //Setting the size
+  write->rows = n;
+  write->columns = columns;
+
+  //Memory for the vector
+  mxElement_t x[MX_SIZE];
+  //For each vector
+  for (unsigned int v=0; v<columns; v++) {
+    for (unsigned int i=0; i<n; i++) {x[i] = result->elements[i][v];}
+    //Forward substitution with L
+    for (unsigned int r=0; r<n; r++) {
+      for (unsigned int c=0; c<r; c++) {x[r] -= l[r][c]*x[c];}
+      x[r] /= l[r][r];
+    }
+    //Backward substitution with L'
+    for (unsigned int r=n; r-->0;) {
+      for (unsigned int c=r+1; c<n; c++) {x[r] -= l[c][r]*x[c];}
+      x[r] /= l[r][r];
+    }
+    //Copy the solution into Write (Result was fully read first, so Write may be the same matrix)
+    for (unsigned int i=0; i<n; i++) {write->elements[i][v] = x[i];}
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Updates a Cholesky decomposition L of A to the decomposition of A+x*x', in O(n²)
+bool mxCholeskyUpdate(matrix *write, const matrix *vector) {
+  //Shorthand for the size
+  unsigned int n = write->rows;
+  //If the decomposition isn't square, or the vector is the wrong size
+  if ((write->columns!=n)||(vector->rows!=n)||(vector->columns!=1)) {return false;}
+
+  //Copy the vector, which is changed as the columns are updated
+  mxElement_t x[MX_SIZE];
+  for (unsigned int i=0; i<n; i++) {x[i] = vector->elements[i][0];}
+  //Shorthand for the elements
+  mxElement_t (*l)[MX_SIZE] = write->elements;
+  //For each column, rotate the vector into it
+  for (unsigned int k=0; k<n; k++) {
+    //If the diagonal is zero, it isn't a Cholesky decomposition
+    if (l[k][k]==0) {return false;}
+    mxElement_t r = sqrt(l[k][k]*l[k][k]+x[k]*x[k]);
+    mxElement_t cosine = r/l[k][k];
+    mxElement_t sine = x[k]/l[k][k];
+    l[k][k] = r;
+    //For each row below the diagonal
+    for (unsigned int i=k+1; i<n; i++) {
+      l[i][k] = (l[i][k]+sine*x[i])/cosine;
+      x[i] = cosine*x[i]-sine*l[i][k];
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Downdates a Cholesky decomposition L of A to the decomposition of A-x*x', in O(n²)
+bool mxCholeskyDowndate(matrix *write, const matrix *vector) {
+  //Shorthand for the size
+  unsigned int n = write->rows;
+  //If the decomposition isn't square, or the vector is the wrong size
+  if ((write->columns!=n)||(vector->rows!=n)||(vector->columns!=1)) {return false;}
+
+  //Shorthand for the elements
+  mxElement_t (*l)[MX_SIZE] = write->elements;
+  /* A-x*x' is only positive-definite if |L⁻¹x| < 1, so check that first (leaving the decomposition unchanged if it isn't) */
+  mxElement_t p[MX_SIZE];
+  mxElement_t length = 0;
+  //Forward substitution with L
+  for (unsigned int r=0; r<n; r++) {
+    if (l[r][r]==0) {return false;}
+    p[r] = vector->elements[r][0];
+    for (unsigned int c=0; c<r; c++) {p[r] -= l[r][c]*p[c];}
+    p[r] /= l[r][r];
+    length += p[r]*p[r];
+  }
+  if (!(length<1)) {return false;}
+
+  //Copy the vector, which is changed as the columns are downdated
+  mxElement_t x[MX_SIZE];
+  for (unsigned int i=0; i<n; i++) {x[i] = vector->elements[i][0];}
+  //For each column, rotate the vector out of it (with a hyperbolic rotation)
+  for (unsigned int k=0; k<n; k++) {
+    mxElement_t r = sqrt(l[k][k]*l[k][k]-x[k]*x[k]);
+    mxElement_t cosine = r/l[k][k];
+    mxElement_t sine = x[k]/l[k][k];
+    l[k][k] = r;
+    //For each row below the diagonal
+    for (unsigned int i=k+1; i<n; i++) {
+      l[i][k] = (l[i][k]-sine*x[i])/cosine;
+      x[i] = cosine*x[i]-sine*l[i][k];
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Decomposes a symmetric matrix into L*D*L', where L is unit lower triangular and D is diagonal
+bool mxLDL(matrix *write, const matrix *read) {
+  //If it's not a square matrix
+  if (read->rows!=read->columns) {return false;}
+
+  //Copy the matrix, which is decomposed in place (so Write is left unchanged if the decomposition doesn't exist)
+  matrix m;
+  mxCopy(&m, read);
+
+  //Shorthand for the size and the elements
+  unsigned int n = m.rows;
+  mxElement_t (*a)[MX_SIZE] = m.elements;
+  //Memory for the row so far, multiplied by the diagonal
+  mxElement_t scaled[MX_SIZE];
+  /* Column by column, using only the lower triangle (D is stored on the diagonal) */
+  //For each column
+  for (unsigned int j=0; j<n; j++) {
+    //Get the diagonal entry, less the weighted squares of the row so far
+    mxElement_t diagonal = a[j][j];
+    for (unsigned int k=0; k<j; k++) {
+      scaled[k] = a[j][k]*a[k][k];
+      diagonal -= a[j][k]*scaled[k];
+    }
+    //If there is a zero pivot, the decomposition doesn't exist (without pivoting)
+    if (diagonal==0) {return false;}
+    a[j][j] = diagonal;
+
+    //For each row below the diagonal
+    for (unsigned int i=j+1; i<n; i++) {
+      //Get the entry, less the weighted products of the two rows so far
+      mxElement_t entry = a[i][j];
+      for (unsigned int k=0; k<j; k++) {entry -= a[i][k]*scaled[k];}
+      a[i][j] = entry/diagonal;
+    }
+  }
+  //Clear the upper triangle
+  for (unsigned int r=0; r<n; r++) {
+    for (unsigned int c=r+1; c<n; c++) {a[r][c] = 0;}
+  }
+  //Copy the decomposition into Write
+  mxCopy(write, &m);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Solves for all vectors, using an LDL' decomposition of the transformation matrix
+bool mxLDLSolve(matrix *write, const matrix *factor, const matrix *result) {
+  //If the result is impossible from the transform
+  if ((factor->rows!=factor->columns)||(factor->rows!=result->rows)) {return false;}
+
+  //Shorthand for the size and the elements
+  unsigned int n = result->rows;
+  unsigned int columns = result->columns;
+  const mxElement_t (*l)[MX_SIZE] = factor->elements;
+  //Setting the size
+  write->rows = n;
+  write->columns = columns;
+
+  //Memory for the vector
+  mxElement_t x[MX_SIZE];
+  //For each vector
+  for (unsigned int v=0; v<columns; v++) {
+    for (unsigned int i=0; i<n; i++) {x[i] = result->elements[i][v];}
+    //Forward substitution with the unit lower triangle L
+    for (unsigned int r=1; r<n; r++) {
+      for (unsigned int c=0; c<r; c++) {x[r] -= l[r][c]*x[c];}
+    }
+    //Divide by D
+    for (unsigned int r=0; r<n; r++) {x[r] /= l[r][r];}
+    //Backward substitution with the unit upper triangle L'
+    for (unsigned int r=n; r-->0;) {
+      for (unsigned int c=r+1; c<n; c++) {x[r] -= l[c][r]*x[c];}
+    }
+    //Copy the solution into Write (Result was fully read first, so Write may be the same matrix)
+    for (unsigned int i=0; i<n; i++) {write->elements[i][v] = x[i];}
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Returns the determinant of the decomposed matrix
+mxElement_t mxLUDeterminant(const mxLUFactor *read) {
+  //Start with the sign of the permutation
+  mxElement_t determinant = read->sign;
+  //Multiply by each entry on the diagonal
+  for (unsigned int i=0; i<read->lu.rows; i++) {determinant *= read->lu.elements[i][i];}
+  //Return the value of the determinant
+  return determinant;
+}
+
+//Decomposes a matrix into an orthogonal matrix Q and an upper triangular matrix R, using Householder reflections
+bool mxQR(mxQRFactor *write, const matrix *read) {
+  //If the matrix is wider than it is tall
+  if (read->rows<read->columns) {return false;}
+
+  //Copy the matrix, which will be decomposed in place
+  mxCopy(&write->qr, read);
+  //Decompose it
+  mxQRKernel(write->qr.elements[0], MX_SIZE, read->rows, read->columns, write->tau);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Solves for all vectors in the least-squares sense, using a QR decomposition of the transformation
+bool mxQRSolve(matrix *write, const mxQRFactor *factor, const matrix *result) {
+  //If the result is impossible from the transform
+  if (factor->qr.rows!=result->rows) {return false;}
+
+  //Temporarily storing the result
+  matrix m;
+  mxCopy(&m, result);
+  //Multiply the result by Q'
+  mxQRApplyTranspose(factor->qr.elements[0], MX_SIZE, factor->qr.rows, factor->qr.columns, factor->tau, m.elements[0], MX_SIZE, m.columns);
+  //Solve with R, using the top rows
+  if (!mxUpperSubstitute(factor->qr.elements[0], MX_SIZE, factor->qr.columns, m.elements[0], MX_SIZE, m.columns)) {return false;}
+
+  //Keep only the top rows, which are the solution
+  m.rows = factor->qr.columns;
+  mxCopy(write, &m);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Finds the eigenvalues and eigenvectors of a symmetric matrix, from largest to smallest
+bool mxEigen(mxElement_t *writeValues, matrix *writeVectors, const matrix *read) {
+  //Find all of them
+  return mxEigen_top(writeValues, writeVectors, read, read->rows);
+}
+
+//Finds the 'count' largest eigenvalues and their eigenvectors of a symmetric matrix, from largest to smallest
+bool mxEigen_top(mxElement_t *writeValues, matrix *writeVectors, const matrix *read, int count) {
+  //If the matrix is not square
+  if (read->rows!=read->columns) {return false;}
+  //If the count is out of range
+  if ((count<0)||(count>(int)read->rows)) {return false;}
+
+  //Copy the matrix, which will be reduced in place, and take the workspace
+  matrix m;
+  mxCopy(&m, read);
+  mxElement_t work[10*MX_SIZE];
+  //Find the eigenvalues (and the eigenvectors, if they're wanted, so Write is left unchanged if the algorithm fails)
+  matrix vectors;
+  if (!mxEigenKernel(writeValues, (writeVectors!=0)? vectors.elements[0]:0, MX_SIZE, m.elements[0], MX_SIZE, read->rows, count, work)) {return false;}
+
+  //Write the eigenvectors, if they're wanted
+  if (writeVectors!=0) {
+    vectors.rows = read->rows;
+    vectors.columns = count;
+    mxCopy(writeVectors, &vectors);
+  }
+  //Indicate that the process was successful
+  return true;
+}
+
+//Decomposes a matrix into U*S*V', where U and V have orthonormal columns and S is diagonal, using one-sided Jacobi rotations
+bool mxSVD(matrix *writeU, mxElement_t *writeValues, matrix *writeV, const matrix *read) {
+  //If the matrix is wider than it is tall, its transpose is decomposed instead (which swaps U and V)
+  bool wide = read->rows<read->columns;
+  //Copy the matrix, which becomes U
+  matrix a, v;
+  if (wide) {mxTranspose(&a, read);}
+  else {mxCopy(&a, read);}
+  //Decompose it
+  if (!mxSVDKernel(a.elements[0], MX_SIZE, a.rows, a.columns, writeValues, v.elements[0], MX_SIZE)) {return false;}
+  v.rows = a.columns;
+  v.columns = a.columns;
+
+  //Write U and V, if they're wanted
+  if (writeU!=0) {mxCopy(writeU, wide? &v:&a);}
+  if (writeV!=0) {mxCopy(writeV, wide? &a:&v);}
+  //Indicate that the process was successful
+  return true;
+}
+
+//Writes the pseudo-inverse of a matrix (which may be rank-deficient or not square), using its singular value decomposition
+bool mxPseudoInverse(matrix *write, const matrix *read) {
+  //Decompose the matrix
+  matrix u, v, ut, m;
+  mxElement_t values[MX_SIZE];
+  if (!mxSVD(&u, values, &v, read)) {return false;}
+  mxTranspose(&ut, &u);
+
+  //Write = V*inverse(S)*U'
+  m.rows = read->columns;
+  m.columns = read->rows;
+  mxPseudoInverseKernel(m.elements[0], MX_SIZE, v.elements[0], MX_SIZE, values, ut.elements[0], MX_SIZE, v.columns, m.rows, m.columns, __FIXED_PACK);
+  mxCopy(write, &m);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Returns the rank of a matrix, counting the singular values above the SVD tolerance (relative to the largest)
+int mxRank(const matrix *read) {
+  //Find the singular values
+  mxElement_t values[MX_SIZE];
+  if (!mxSVD(0, values, 0, read)) {return -1;}
+  //Count the ones that aren't zero
+  int count = (read->rows<read->columns)? read->rows:read->columns;
+  int rank = 0;
+  while ((rank<count)&&(values[rank]>__SVD_TOLERANCE(read->rows, read->columns)*values[0])) {rank++;}
+  return rank;
+}
+
+//Writes the exponential of a square matrix, using scaling and squaring with a Padé approximant
+bool mxExp(matrix *write, const matrix *read) {
+  //If it's not a square matrix
+  if (read->rows!=read->columns) {return false;}
+
+  //Shorthand for the size
+  unsigned int n = read->rows;
+  //The exponential of an empty matrix is empty
+  if (n==0) {
+    mxCopy(write, read);
+    return true;
+  }
+  //Find the exponential, with workspace for the powers on the stack
+  mxElement_t work[6*n*n+n];
+  if (!mxExpKernel(write->elements[0], MX_SIZE, read->elements[0], MX_SIZE, n, 1, work, __FIXED_PACK)) {return false;}
+  //Set the size
+  write->rows = n;
+  write->columns = n;
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Discretises a continuous state-space model (A, B) with a zero-order hold, writing (Ad, Bd)
+bool mxDiscretise(matrix *writeA, matrix *writeB, const matrix *a, const matrix *b, double period) {
+  //If A isn't square, or B doesn't have a row for each state
+  if ((a->rows!=a->columns)||(b->rows!=a->rows)||(a->rows==0)) {return false;}
+
+  //Shorthand for the number of states and inputs
+  unsigned int n = a->rows;
+  unsigned int m = b->columns;
+  //Discretise, with workspace for the block matrix and its exponential on the stack
+  mxElement_t work[8*(n+m)*(n+m)+n+m];
+  if (!mxDiscretiseKernel(writeA->elements[0], MX_SIZE, writeB->elements[0], MX_SIZE, a->elements[0], MX_SIZE, b->elements[0], MX_SIZE, n, m, period, work, __FIXED_PACK)) {return false;}
+  //Set the sizes
+  writeA->rows = n;
+  writeA->columns = n;
+  writeB->rows = n;
+  writeB->columns = m;
+
+  //Indicate that the process was successful
+  return true;
+}
+
+/*================================*/
+/* DYNAMIC MATRICES ================================*/
+
+//Sets up an arena, which hands out storage from a buffer
+void mxArenaInit(mxArena *write, mxElement_t *buffer, int size) {
+  write->buffer = buffer;
+  write->size = size;
+  write->used = 0;
+}
+
+//Takes storage from an arena
+mxElement_t *mxArenaAlloc(mxArena *write, int count) {
+  //If there is not enough space left
+  if ((count<0)||(count>write->size-write->used)) {return 0;}
+
+  //Hand out the next unused elements
+  mxElement_t *storage = write->buffer+write->used;
+  write->used += count;
+  return storage;
+}
+
+//Takes storage for indices from an arena (rounded up to whole elements)
+unsigned int *mxArenaAllocIndices(mxArena *write, int count) {
+  //If the count is impossible
+  if (count<0) {return 0;}
+  //Take as many elements as it takes to hold the indices
+  return (unsigned int*)mxArenaAlloc(write, (count*sizeof(unsigned int)+sizeof(mxElement_t)-1)/sizeof(mxElement_t));
+}
+
+//Returns all the storage that an arena has handed out
+void mxArenaReset(mxArena *write) {
+  write->used = 0;
+}
+
+//Sets up a dynamic matrix over storage, with rows stored one after another
+bool mxDynInit(mxDyn *write, mxElement_t *storage, int rows, int columns) {
+  return mxDynInit_stride(write, storage, rows, columns, columns);
+}
+
+//Sets up a dynamic matrix over storage, with a gap between the starts of consecutive rows
+bool mxDynInit_stride(mxDyn *write, mxElement_t *storage, int rows, int columns, int stride) {
+  //If the size is impossible
+  if ((rows<0)||(columns<0)||(stride<columns)) {return false;}
+
+  //Set the size and storage
+  write->rows = rows;
+  write->columns = columns;
+  write->stride = stride;
+  write->elements = storage;
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Sets up a dynamic matrix with storage taken from an arena
+bool mxDynAlloc(mxDyn *write, mxArena *arena, int rows, int columns) {
+  //If the size is impossible
+  if ((rows<0)||(columns<0)) {return false;}
+  //Take the storage
+  mxElement_t *storage = mxArenaAlloc(arena, rows*columns);
+  //If there is not enough space left
+  if (storage==0) {return false;}
+
+  return mxDynInit(write, storage, rows, columns);
+}
+
+//Sets up a dynamic matrix that shares the storage of a matrix
+void mxDynWrap(mxDyn *write, matrix *read) {
+  write->rows = read->rows;
+  write->columns = read->columns;
+  write->stride = MX_SIZE;
+  write->elements = read->elements[0];
+}
+
+//Copies a matrix's elements into a dynamic matrix of the same size
+bool mxDynFromMatrix(mxDyn *write, const matrix *read) {
+  //If the sizes are different
+  if ((write->rows!=read->rows)||(write->columns!=read->columns)) {return false;}
+
+  //For each row
+  for (unsigned int r=0; r<read->rows; r++) {
+    //For each column
+    for (unsigned int c=0; c<read->columns; c++) {
+      //Copy the element
+      write->elements[r*write->stride+c] = read->elements[r][c];
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Copies a dynamic matrix's elements into a matrix
+bool mxDynToMatrix(matrix *write, const mxDyn *read) {
+  //If the dynamic matrix is too large
+  if ((read->rows>MX_SIZE)||(read->columns>MX_SIZE)) {return false;}
+
+  //Set the size
+  write->rows = read->rows;
+  write->columns = read->columns;
+  //For each row
+  for (unsigned int r=0; r<read->rows; r++) {
+    //For each column
+    for (unsigned int c=0; c<read->columns; c++) {
+      //Copy the element
+      write->elements[r][c] = read->elements[r*read->stride+c];
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Returns the element in the given row and column
+mxElement_t mxDynReadElement(const mxDyn *read, int row, int column) {
+  //If the index is out of bounds
+  if ((row<0)||(column<0)||(read->rows<=row)||(read->columns<=column)) {return __FAIL;}
+  //Returning the element
+  return read->elements[row*read->stride+column];
+}
+
+//Writes an entry into the given row and column of the given dynamic matrix
+bool mxDynWriteElement(mxDyn *write, int row, int column, mxElement_t entry) {
+  //If the index is out of bounds (the storage can't grow)
+  if ((row<0)||(column<0)||(write->rows<=row)||(write->columns<=column)) {return false;}
+
+  //Writing the entry
+  write->elements[row*write->stride+column] = entry;
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Copies the second dynamic matrix's elements onto the first
+bool mxDynCopy(mxDyn *write, const mxDyn *read) {
+  //If the sizes are different
+  if ((write->rows!=read->rows)||(write->columns!=read->columns)) {return false;}
+  //If they're already the same storage, there's nothing to copy
+  if ((write->elements==read->elements)&&(write->stride==read->stride)) {return true;}
+
+  //For each row
+  for (unsigned int r=0; r<read->rows; r++) {
+    //For each column
+    for (unsigned int c=0; c<read->columns; c++) {
+      //Copy the element
+      write->elements[r*write->stride+c] = read->elements[r*read->stride+c];
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Checks if two dynamic matrices are equal
+bool mxDynEqual(const mxDyn *read1, const mxDyn *read2) {
+  //If the sizes are different, the matrices aren't equal
+  if ((read1->rows!=read2->rows)||(read1->columns!=read2->columns)) {return false;}
+
+  //For each row
+  for (unsigned int r=0; r<read1->rows; r++) {
+    //For each column
+    for (unsigned int c=0; c<read1->columns; c++) {
+      //If the entries are not the same, the matrices aren't equal
+      if (read1->elements[r*read1->stride+c]!=read2->elements[r*read2->stride+c]) {return false;}
+    }
+  }
+  //If we've reached this step, the matrices are equal
+  return true;
+}
+
+//Sets every element of a dynamic matrix to 0
+void mxDynZero(mxDyn *write) {
+  //For each row
+  for (unsigned int r=0; r<write->rows; r++) {
+    //For each column
+    for (unsigned int c=0; c<write->columns; c++) {
+      //Replace the entry with 0
+      write->elements[r*write->stride+c] = 0;
+    }
+  }
+}
+
+//Turns a square dynamic matrix into the identity matrix
+bool mxDynIdentity(mxDyn *write) {
+  //If it's not a square matrix
+  if (write->rows!=write->columns) {return false;}
+
+  //For each row
+  for (unsigned int r=0; r<write->rows; r++) {
+    //For each column
+    for (unsigned int c=0; c<write->columns; c++) {
+      //Replace the entry with 1 on the diagonal, otherwise with 0
+      write->elements[r*write->stride+c] = (r==c)? 1:0;
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Adds the second dynamic matrix to the first
+bool mxDynAdd(mxDyn *write, const mxDyn *read1, const mxDyn *read2) {
+  //If the matrices can't be added
+  if ((read1->rows!=read2->rows)||(read1->columns!=read2->columns)) {return false;}
+  //If Write is the wrong size
+  if ((write->rows!=read1->rows)||(write->columns!=read1->columns)) {return false;}
+
+  //Add the elements (each element only depends on the same position, so storage may be shared)
+  mxAddKernel(write->elements, write->stride, read1->elements, read1->stride, read2->elements, read2->stride, write->rows, write->columns);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Scales/Multiplies the given dynamic matrix by a factor
+bool mxDynScale(mxDyn *write, const mxDyn *read, double factor) {
+  //If Write is the wrong size
+  if ((write->rows!=read->rows)||(write->columns!=read->columns)) {return false;}
+
+  //Scale the elements
+  mxScaleKernel(write->elements, write->stride, read->elements, read->stride, write->rows, write->columns, factor);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Multiplies two dynamic matrices
+bool mxDynMultiply(mxDyn *write, const mxDyn *read1, const mxDyn *read2) {
+  //If the matrices can't be multiplied
+  if (read1->columns!=read2->rows) {return false;}
+  //If Write is the wrong size
+  if ((write->rows!=read1->rows)||(write->columns!=read2->columns)) {return false;}
+  //If Write shares storage with either matrix
+  if ((write->elements==read1->elements)||(write->elements==read2->elements)) {return false;}
+
+  //Multiply the elements (without an arena to pack into, so large matrices are better multiplied with mxDynGemm)
+  mxGemmKernel(write->elements, write->stride, 1, read1->elements, read1->stride, read2->elements, read2->stride, 0, read1->rows, read1->columns, read2->columns, 0);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Multiplies two dynamic matrices, and accumulates them into a scaled Write
+bool mxDynGemm(mxDyn *write, double alpha, const mxDyn *read1, const mxDyn *read2, double beta, mxArena *work) {
+  //If the matrices can't be multiplied
+  if (read1->columns!=read2->rows) {return false;}
+  //If Write is the wrong size
+  if ((write->rows!=read1->rows)||(write->columns!=read2->columns)) {return false;}
+  //If Write shares storage with either matrix
+  if ((write->elements==read1->elements)||(write->elements==read2->elements)) {return false;}
+
+  //Take space to pack large matrices into, if there's room
+  unsigned int used = (work!=0)? work->used:0;
+  mxElement_t *pack = mxGemmPack(work);
+  //Multiply and accumulate the elements
+  mxGemmKernel(write->elements, write->stride, alpha, read1->elements, read1->stride, read2->elements, read2->stride, beta, read1->rows, read1->columns, read2->columns, pack);
+
+  //Give the space back to the arena
+  if (work!=0) {work->used = used;}
+  //Indicate that the process was successful
+  return true;
+}
+
+//Transposes the given dynamic matrix
+bool mxDynTranspose(mxDyn *write, const mxDyn *read) {
+  //If Write is the wrong size
+  if ((write->rows!=read->columns)||(write->columns!=read->rows)) {return false;}
+  //If Write shares storage with Read
+  if (write->elements==read->elements) {return false;}
+
+  //Transpose the elements, in cache-sized pieces
+  mxTransposeKernel(write->elements, write->stride, read->elements, read->stride, read->rows, read->columns);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Transposes a square dynamic matrix in place
+bool mxDynTranspose_inplace(mxDyn *write) {
+  //If the matrix is not square
+  if (write->rows!=write->columns) {return false;}
+
+  //Transpose the elements in place, in cache-sized pieces
+  mxTransposeSquareKernel(write->elements, write->stride, write->rows);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Turns a dynamic matrix into Reduced Row Echelon Form, and edits 1 additional dynamic matrix as collateral
+bool mxDynReducedEchelon_coll(mxDyn *writeReduce, mxDyn *writeCollateral, const mxDyn *readReduce, const mxDyn *readCollateral, mxArena *work) {
+  //If the collateral matrix doesn't have a row for each row of the matrix
+  if ((readCollateral->columns!=0)&&(readCollateral->rows!=readReduce->rows)) {return false;}
+
+  //Remember how much of the arena was used, to give the space back afterwards
+  unsigned int used = work->used;
+  //Memory for the order the rows are left in
+  unsigned int *order = mxArenaAllocIndices(work, readReduce->rows);
+  //If there is not enough space
+  if (order==0) {return false;}
+
+  //Copy the matrices (if they're different storage)
+  if (!(mxDynCopy(writeReduce, readReduce)&&mxDynCopy(writeCollateral, readCollateral))) {
+    work->used = used;
+    return false;
+  }
+
+  //Reduce the copies in place, then put the rows in order
+  mxReduceKernel(writeReduce->elements, writeReduce->stride, writeReduce->rows, writeReduce->columns, writeCollateral->elements, writeCollateral->stride, writeCollateral->columns, order);
+  mxReorderRows(writeReduce->elements, writeReduce->stride, writeReduce->rows, writeReduce->columns, writeCollateral->elements, writeCollateral->stride, writeCollateral->columns, order);
+
+  //Give back the space, and indicate that the process was successful
+  work->used = used;
+  return true;
+}
+
+//Turns a dynamic matrix into Reduced Row Echelon Form
+bool mxDynReducedEchelon(mxDyn *write, const mxDyn *read, mxArena *work) {
+  //Creating an empty collateral matrix
+  mxDyn none = {read->rows, 0, 0, 0};
+
+  //Turning the matrix into Reduced Row Echelon Form
+  return mxDynReducedEchelon_coll(write, &none, read, &none, work);
+}
+
+//Solves for all vectors where possible, using Guass reduction
+bool mxDynSolveGauss(mxDyn *write, const mxDyn *transform, const mxDyn *result, mxArena *work) {
+  //If the result is impossible from the transform
+  if (transform->rows!=result->rows) {return false;}
+  //If Write is the wrong size
+  if ((write->rows!=transform->columns)||(write->columns!=result->columns)) {return false;}
+
+  //Remember how much of the arena was used, to give the space back afterwards
+  unsigned int used = work->used;
+  //Creating new matrices to do row operations on
+  mxDyn transform0;
+  mxDyn result0;
+  //Memory for the order the rows are left in
+  unsigned int *order = 0;
+  if (!(mxDynAlloc(&transform0, work, transform->rows, transform->columns)&&mxDynAlloc(&result0, work, result->rows, result->columns)&&(order = mxArenaAllocIndices(work, transform->rows)))) {
+    //If there is not enough space
+    work->used = used;
+    return false;
+  }
+
+  //Gauss Reduction (each row is solved on its own, so the rows are left out of order)
+  mxDynCopy(&transform0, transform);
+  mxDynCopy(&result0, result);
+  mxReduceKernel(transform0.elements, transform0.stride, transform0.rows, transform0.columns, result0.elements, result0.stride, result0.columns, order);
+
+  /* To solve for the vectors, we're going to make all free variables equal 0,
+  and only pivots will have a non-zero value */
+  //Start with every variable unsolved (zero)
+  mxDynZero(write);
+  //Whether the process was successful
+  bool success = true;
+  //For each row in the transformation
+  for (unsigned int r=0; (r<transform0.rows)&&success; r++) {
+    //Shorthand for the row
+    const mxElement_t *row = transform0.elements+r*transform0.stride;
+    //Start with the first column
+    unsigned int c = 0;
+    //Search for the pivot, left to right
+    while ((c+1<transform0.columns)&&(row[c]==0)) {c++;}
+    //For each output vector
+    for (unsigned int v=0; v<result0.columns; v++) {
+      //Shorthand for the result
+      mxElement_t entry = result0.elements[r*result0.stride+v];
+      //If no pivot was found
+      if ((transform0.columns==0)||(row[c]==0)) {
+        //If the result is non-zero, then there is no possible solution
+        if (entry!=0) {success = false;}
+      } else {
+        //Solve for the pivot-variable
+        write->elements[c*write->stride+v] = entry/row[c];
+      }
+    }
+  }
+
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the process was successful
+  return success;
+}
+
+//Decomposes a dynamic matrix into an orthogonal matrix Q and an upper triangular matrix R, using blocks of Householder reflections
+bool mxDynQR(mxDyn *write, mxElement_t *tau, const mxDyn *read, mxArena *work) {
+  //If the matrix is wider than it is tall
+  if (read->rows<read->columns) {return false;}
+  //If Write is the wrong size
+  if ((write->rows!=read->rows)||(write->columns!=read->columns)) {return false;}
+
+  //Start Write as a copy of Read (it's decomposed in place)
+  mxDynCopy(write, read);
+  //Shorthand for the size and the elements
+  unsigned int m = write->rows;
+  unsigned int n = write->columns;
+  unsigned int s = write->stride;
+  mxElement_t *a = write->elements;
+  //If the matrix is narrow enough, there's no need for blocks
+  if (n<=MX_QR_BLOCK) {
+    mxQRKernel(a, s, m, n, tau);
+    return true;
+  }
+
+  //Take the workspace: the block's reflectors (and their transpose), its triangular factor T, and two products
+  unsigned int used = work->used;
+  unsigned int nb = MX_QR_BLOCK;
+  mxElement_t *v = mxArenaAlloc(work, m*nb);
+  mxElement_t *vt = mxArenaAlloc(work, nb*m);
+  mxElement_t *t = mxArenaAlloc(work, nb*nb);
+  mxElement_t *w = mxArenaAlloc(work, nb*n);
+  mxElement_t *w2 = mxArenaAlloc(work, nb*n);
+  if ((v==0)||(vt==0)||(t==0)||(w==0)||(w2==0)) {
+    work->used = used;
+    return false;
+  }
+
+  //Take space to pack the updates into, if there's room
+  mxElement_t *pack = mxGemmPack(work);
+
+  /* The block's reflectors H1*H2*...*Hb are combined into I-V*T*V', so the rest of the matrix
+  can be updated with matrix multiplications (which stay in cache) instead of one reflector at a time */
+  //For each block of columns
+  for (unsigned int k=0; k<n; k+=nb) {
+    //Size of the block
+    unsigned int b = (n-k<nb)? n-k:nb;
+    unsigned int height = m-k;
+    //Decompose the block one column at a time
+    mxQRKernel(a+k*s+k, s, height, b, tau+k);
+    //If this is the last block, there's nothing left to update
+    if (k+b>=n) {break;}
+
+    //Copy out the reflectors, with their leading 1s and the zeros above them
+    for (unsigned int r=0; r<height; r++) {
+      for (unsigned int c=0; c<b; c++) {
+        mxElement_t entry = (r>c)? a[(k+r)*s+k+c]:((r==c)? 1:0);
+        v[r*b+c] = entry;
+        vt[c*height+r] = entry;
+      }
+    }
+    //Build the upper triangular T, one column at a time
+    for (unsigned int i=0; i<b; i++) {
+      //T[0..i-1][i] = -tau*V[:,0..i-1]'*v (v is zero above row i)
+      for (unsigned int j=0; j<i; j++) {
+        mxElement_t dot = 0;
+        for (unsigned int r=i; r<height; r++) {dot += vt[j*height+r]*vt[i*height+r];}
+        t[j*b+i] = -tau[k+i]*dot;
+      }
+      //Then multiply by the T so far (top-down, so each entry is used before it's replaced)
+      for (unsigned int j=0; j<i; j++) {
+        mxElement_t sum = 0;
+        for (unsigned int l=j; l<i; l++) {sum += t[j*b+l]*t[l*b+i];}
+        t[j*b+i] = sum;
+      }
+      t[i*b+i] = tau[k+i];
+      for (unsigned int j=i+1; j<b; j++) {t[j*b+i] = 0;}
+    }
+
+    /* Update the rest of the matrix: C = (I-V*T'*V')*C = C-V*(T'*(V'*C)) */
+    unsigned int columns = n-k-b;
+    mxElement_t *rest = a+k*s+k+b;
+    //W = V'*C
+    mxGemmKernel(w, columns, 1, vt, height, rest, s, 0, b, height, columns, pack);
+    //W2 = T'*W (T' is lower triangular)
+    for (unsigned int i=0; i<b; i++) {
+      for (unsigned int c=0; c<columns; c++) {w2[i*columns+c] = 0;}
+      for (unsigned int l=0; l<=i; l++) {
+        mxElement_t scalar = t[l*b+i];
+        for (unsigned int c=0; c<columns; c++) {w2[i*columns+c] += scalar*w[l*columns+c];}
+      }
+    }
+    //C = C-V*W2
+    mxGemmKernel(rest, s, -1, v, b, w2, columns, 1, height, b, columns, pack);
+  }
+
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate that the process was successful
+  return true;
+}
+
+//Solves for all vectors in the least-squares sense, using a QR decomposition of the transformation
+bool mxDynQRSolve(mxDyn *write, const mxDyn *factor, const mxElement_t *tau, const mxDyn *result, mxArena *work) {
+  //If the result is impossible from the transform
+  if (factor->rows!=result->rows) {return false;}
+  //If Write is the wrong size
+  if ((write->rows!=factor->columns)||(write->columns!=result->columns)) {return false;}
+
+  //Take a copy of the result to work on
+  unsigned int used = work->used;
+  mxDyn c;
+  if (!mxDynAlloc(&c, work, result->rows, result->columns)) {return false;}
+  mxDynCopy(&c, result);
+
+  //Multiply the result by Q'
+  mxQRApplyTranspose(factor->elements, factor->stride, factor->rows, factor->columns, tau, c.elements, c.stride, c.columns);
+  //Solve with R, using the top rows
+  bool success = mxUpperSubstitute(factor->elements, factor->stride, factor->columns, c.elements, c.stride, c.columns);
+  //Copy the solution into Write
+  if (success) {
+    for (unsigned int r=0; r<write->rows; r++) {
+      for (unsigned int v=0; v<write->columns; v++) {write->elements[r*write->stride+v] = c.elements[r*c.stride+v];}
+    }
+  }
+
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the process was successful
+  return success;
+}
+
+//Solves for all vectors in the least-squares sense, for a transformation with at least as many rows as columns
+bool mxDynSolveLeastSquares(mxDyn *write, const mxDyn *transform, const mxDyn *result, mxArena *work) {
+  //Take space for the decomposition
+  unsigned int used = work->used;
+  mxDyn factor;
+  mxElement_t *tau = mxArenaAlloc(work, transform->columns);
+  if ((tau==0)||!mxDynAlloc(&factor, work, transform->rows, transform->columns)) {
+    work->used = used;
+    return false;
+  }
+
+  //Decompose the transform, and solve for the vectors
+  bool success = mxDynQR(&factor, tau, transform, work)&&mxDynQRSolve(write, &factor, tau, result, work);
+
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the process was successful
+  return success;
+}
+
+//Finds the eigenvalues and eigenvectors of a symmetric dynamic matrix, from largest to smallest
+bool mxDynEigen(mxElement_t *writeValues, mxDyn *writeVectors, const mxDyn *read, mxArena *work) {
+  //Find all of them
+  return mxDynEigen_top(writeValues, writeVectors, read, read->rows, work);
+}
+
+//Finds the 'count' largest eigenvalues and their eigenvectors of a symmetric dynamic matrix, from largest to smallest
+bool mxDynEigen_top(mxElement_t *writeValues, mxDyn *writeVectors, const mxDyn *read, int count, mxArena *work) {
+  //If the matrix is not square
+  if (read->rows!=read->columns) {return false;}
+  //If the count is out of range
+  if ((count<0)||(count>(int)read->rows)) {return false;}
+  //If Write is the wrong size
+  if ((writeVectors!=0)&&((writeVectors->rows!=read->rows)||(writeVectors->columns!=(unsigned int)count))) {return false;}
+
+  //Take a copy of the matrix to reduce, and the workspace
+  unsigned int used = work->used;
+  unsigned int n = read->rows;
+  mxDyn m;
+  mxElement_t *space = mxArenaAlloc(work, 10*n);
+  if ((space==0)||!mxDynAlloc(&m, work, n, n)) {
+    work->used = used;
+    return false;
+  }
+  mxDynCopy(&m, read);
+
+  //Find the eigenvalues (and the eigenvectors, if they're wanted)
+  bool success = mxEigenKernel(writeValues, (writeVectors!=0)? writeVectors->elements:0, (writeVectors!=0)? writeVectors->stride:0, m.elements, m.stride, n, count, space);
+
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the process was successful
+  return success;
+}
+
+//Decomposes a dynamic matrix into U*S*V', where U and V have orthonormal columns and S is diagonal, using one-sided Jacobi rotations
+bool mxDynSVD(mxDyn *writeU, mxElement_t *writeValues, mxDyn *writeV, const mxDyn *read, mxArena *work) {
+  //If the matrix is wider than it is tall, its transpose is decomposed instead (which swaps U and V)
+  bool wide = read->rows<read->columns;
+  unsigned int m = wide? read->columns:read->rows;
+  unsigned int n = wide? read->rows:read->columns;
+  //If Write is the wrong size
+  if ((writeU!=0)&&((writeU->rows!=read->rows)||(writeU->columns!=n))) {return false;}
+  if ((writeV!=0)&&((writeV->rows!=read->columns)||(writeV->columns!=n))) {return false;}
+
+  //Take a copy of the matrix (which becomes U), and space for V
+  unsigned int used = work->used;
+  mxDyn a, v;
+  if (!mxDynAlloc(&a, work, m, n)||!mxDynAlloc(&v, work, n, n)) {
+    work->used = used;
+    return false;
+  }
+  if (wide) {mxDynTranspose(&a, read);}
+  else {mxDynCopy(&a, read);}
+
+  //Decompose it, then write U and V, if they're wanted
+  bool success = mxSVDKernel(a.elements, a.stride, m, n, writeValues, v.elements, v.stride);
+  if (success) {
+    if (writeU!=0) {mxDynCopy(writeU, wide? &v:&a);}
+    if (writeV!=0) {mxDynCopy(writeV, wide? &a:&v);}
+  }
+
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the process was successful
+  return success;
+}
+
+//Finds the 'count' largest singular values and their vectors of a dynamic matrix, using a randomized range finder
+bool mxDynSVD_top(mxDyn *writeU, mxElement_t *writeValues, mxDyn *writeV, const mxDyn *read, int count, mxArena *work) {
+  //Shorthand for the size
+  unsigned int m = read->rows;
+  unsigned int n = read->columns;
+  unsigned int smaller = (m<n)? m:n;
+  //If the count is out of range
+  if ((count<0)||(count>(int)smaller)) {return false;}
+  //If Write is the wrong size
+  if ((writeU!=0)&&((writeU->rows!=m)||(writeU->columns!=(unsigned int)count))) {return false;}
+  if ((writeV!=0)&&((writeV->rows!=n)||(writeV->columns!=(unsigned int)count))) {return false;}
+  //Number of random samples of the range (a few more than the count, so the top values are accurate)
+  unsigned int l = count+MX_SVD_OVERSAMPLE;
+  if (l>smaller) {l = smaller;}
+  if (l==0) {return true;}
+
+  //Take the workspace: A', the samples (of the columns and the rows), a product, the small V, and the small decomposition
+  unsigned int used = work->used;
+  mxElement_t *at = mxArenaAlloc(work, n*m);
+  mxElement_t *y = mxArenaAlloc(work, m*l);
+  mxElement_t *z = mxArenaAlloc(work, n*l);
+  mxElement_t *p = mxArenaAlloc(work, m*l);
+  mxElement_t *vb = mxArenaAlloc(work, l*l);
+  mxElement_t *tau = mxArenaAlloc(work, l);
+  mxElement_t *values = mxArenaAlloc(work, l);
+  if ((at==0)||(y==0)||(z==0)||(p==0)||(vb==0)||(tau==0)||(values==0)) {
+    work->used = used;
+    return false;
+  }
+  //Take space to pack the products into, if there's room
+  mxElement_t *pack = mxGemmPack(work);
+  //A' is kept, so both products are row-major multiplications
+  for (unsigned int r=0; r<m; r++) {
+    for (unsigned int c=0; c<n; c++) {at[c*m+r] = read->elements[r*read->stride+c];}
+  }
+
+  /* Sample the range of A: Y = A*Omega, with random Omega, and a few power iterations Y = A*(A'*Y)
+  (re-orthonormalised each time), so the top singular vectors stand out from the rest */
+  unsigned int seed = 12345;
+  for (unsigned int i=0; i<n*l; i++) {
+    seed = seed*1103515245+12345;
+    z[i] = (mxElement_t)((seed>>16)&0x7fff)/0x4000-1;
+  }
+  mxGemmKernel(y, l, 1, read->elements, read->stride, z, l, 0, m, n, l, pack);
+  for (unsigned int iteration=0; iteration<MX_SVD_POWER; iteration++) {
+    mxQRKernel(y, l, m, l, tau);
+    mxQRFormQ(y, l, m, l, tau);
+    mxGemmKernel(z, l, 1, at, m, y, l, 0, n, m, l, pack);
+    mxQRKernel(z, l, n, l, tau);
+    mxQRFormQ(z, l, n, l, tau);
+    mxGemmKernel(y, l, 1, read->elements, read->stride, z, l, 0, m, n, l, pack);
+  }
+  //Q is an orthonormal basis of the samples
+  mxQRKernel(y, l, m, l, tau);
+  mxQRFormQ(y, l, m, l, tau);
+
+  /* Decompose the small matrix B' = A'*Q = Ub*S*Vb', so A = Q*B = (Q*Vb)*S*Ub' */
+  mxGemmKernel(z, l, 1, at, m, y, l, 0, n, m, l, pack);
+  bool success = mxSVDKernel(z, l, n, l, values, vb, l);
+  //Write the largest singular values and their vectors
+  if (success) {
+    for (unsigned int k=0; k<(unsigned int)count; k++) {writeValues[k] = values[k];}
+    if (writeU!=0) {
+      mxGemmKernel(p, l, 1, y, l, vb, l, 0, m, l, l, pack);
+      for (unsigned int r=0; r<m; r++) {
+        for (unsigned int k=0; k<(unsigned int)count; k++) {writeU->elements[r*writeU->stride+k] = p[r*l+k];}
+      }
+    }
+    if (writeV!=0) {
+      for (unsigned int r=0; r<n; r++) {
+        for (unsigned int k=0; k<(unsigned int)count; k++) {writeV->elements[r*writeV->stride+k] = z[r*l+k];}
+      }
+    }
+  }
+
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the process was successful
+  return success;
+}
+
+//Writes the pseudo-inverse of a dynamic matrix (which may be rank-deficient or not square), using its singular value decomposition
+bool mxDynPseudoInverse(mxDyn *write, const mxDyn *read, mxArena *work) {
+  //If Write is the wrong size
+  if ((write->rows!=read->columns)||(write->columns!=read->rows)) {return false;}
+  //If Write shares storage with Read
+  if (write->elements==read->elements) {return false;}
+
+  //Take space for the decomposition, and U'
+  unsigned int used = work->used;
+  unsigned int k = (read->rows<read->columns)? read->rows:read->columns;
+  mxDyn u, v, ut;
+  mxElement_t *values = mxArenaAlloc(work, k);
+  if ((values==0)||!mxDynAlloc(&u, work, read->rows, k)||!mxDynAlloc(&v, work, read->columns, k)||!mxDynAlloc(&ut, work, k, read->rows)) {
+    work->used = used;
+    return false;
+  }
+
+  //Decompose the matrix, then Write = V*inverse(S)*U'
+  bool success = mxDynSVD(&u, values, &v, read, work);
+  if (success) {
+    mxDynTranspose(&ut, &u);
+    mxPseudoInverseKernel(write->elements, write->stride, v.elements, v.stride, values, ut.elements, ut.stride, k, write->rows, write->columns, mxGemmPack(work));
+  }
+
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the process was successful
+  return success;
+}
+
+//Returns the rank of a dynamic matrix, counting the singular values above the SVD tolerance (relative to the largest)
+int mxDynRank(const mxDyn *read, mxArena *work) {
+  //Take space for the singular values
+  unsigned int used = work->used;
+  int count = (read->rows<read->columns)? read->rows:read->columns;
+  mxElement_t *values = mxArenaAlloc(work, count);
+  //Find them, then count the ones that aren't zero
+  int rank = -1;
+  if ((values!=0)&&mxDynSVD(0, values, 0, read, work)) {
+    rank = 0;
+    while ((rank<count)&&(values[rank]>__SVD_TOLERANCE(read->rows, read->columns)*values[0])) {rank++;}
+  }
+  //Give the space back to the arena
+  work->used = used;
+  return rank;
+}
+
+//Writes the exponential of a square dynamic matrix, using scaling and squaring with a Padé approximant
+bool mxDynExp(mxDyn *write, const mxDyn *read, mxArena *work) {
+  //If it's not a square matrix, or Write is the wrong size
+  if ((read->rows!=read->columns)||(write->rows!=read->rows)||(write->columns!=read->columns)) {return false;}
+
+  //Take space for the powers
+  unsigned int used = work->used;
+  unsigned int n = read->rows;
+  mxElement_t *space = mxArenaAlloc(work, 6*n*n+n);
+  //Find the exponential
+  bool success = (space!=0)&&mxExpKernel(write->elements, write->stride, read->elements, read->stride, n, 1, space, mxGemmPack(work));
+
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the process was successful
+  return success;
+}
+
+//Discretises a continuous state-space model (A, B) with a zero-order hold, writing (Ad, Bd)
+bool mxDynDiscretise(mxDyn *writeA, mxDyn *writeB, const mxDyn *a, const mxDyn *b, double period, mxArena *work) {
+  //If A isn't square, B doesn't have a row for each state, or Write is the wrong size
+  if ((a->rows!=a->columns)||(b->rows!=a->rows)) {return false;}
+  if ((writeA->rows!=a->rows)||(writeA->columns!=a->columns)||(writeB->rows!=b->rows)||(writeB->columns!=b->columns)) {return false;}
+
+  //Take space for the block matrix, its exponential and the powers
+  unsigned int used = work->used;
+  unsigned int size = a->rows+b->columns;
+  mxElement_t *space = mxArenaAlloc(work, 8*size*size+size);
+  //Discretise
+  bool success = (space!=0)&&mxDiscretiseKernel(writeA->elements, writeA->stride, writeB->elements, writeB->stride, a->elements, a->stride, b->elements, b->stride, a->rows, b->columns, period, space, mxGemmPack(work));
+
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the process was successful
+  return success;
+}
+
+//Updates the inverse of a dynamic matrix to the inverse of the matrix plus U*V', in O(n²k)
+bool mxDynInverseUpdate(mxDyn *write, const mxDyn *u, const mxDyn *v, mxArena *work) {
+  //Shorthand for the size and the rank of the update
+  unsigned int n = write->rows;
+  unsigned int k = u->columns;
+  //If the inverse isn't square, or U and V are the wrong sizes
+  if ((write->columns!=n)||(u->rows!=n)||(v->rows!=n)||(v->columns!=k)||(k==0)) {return false;}
+
+  //Take space for the workspace
+  unsigned int used = work->used;
+  mxElement_t *space = mxArenaAlloc(work, 2*n*k+k*k+k);
+  //Update the inverse in place
+  bool success = (space!=0)&&mxWoodburyKernel(write->elements, write->stride, n, u->elements, u->stride, v->elements, v->stride, k, space, mxGemmPack(work));
+
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the process was successful
+  return success;
+}
+
+/*================================*/
+/* VIEWS ================================*/
+
+//Returns a pointer to an element of a view
+static mxElement_t *mxViewAt(const mxView *view, unsigned int row, unsigned int column) {
+  //Step over the left-out row and column
+  if (row>=view->skipRow) {row++;}
+  if (column>=view->skipColumn) {column++;}
+  return view->elements+row*view->rowStride+column*view->columnStride;
+}
+
+//Whether a view is plain row-major elements (so the row-major kernels can be used)
+static bool mxViewRowMajor(const mxView *view) {
+  return (view->columnStride==1)&&(view->skipRow>=view->rows)&&(view->skipColumn>=view->columns);
+}
+
+#ifdef MX_EXACT
+//Finds the determinant of the rows of a view from 'row' down, with the columns that aren't used yet, by cofactor expansion
+static mxElement_t mxViewExpand(const mxView *read, unsigned int row, bool *used) {
+  //Set the determinant to 0 initially
+  mxElement_t determinant = 0;
+  //Set the sign to positive
+  signed int sign = 1;
+  //For each column that isn't used yet
+  for (unsigned int c=0; c<read->columns; c++) {
+    if (used[c]) {continue;}
+    //If this is the last row, its only unused element is the determinant
+    if (row+1==read->rows) {return *mxViewAt(read, row, c);}
+    //Add the element multiplied by the cofactor to the determinant (the minor leaves out this row and column)
+    used[c] = true;
+    determinant += (*mxViewAt(read, row, c))*sign*mxViewExpand(read, row+1, used);
+    used[c] = false;
+    //Change the sign for the next cofactor
+    sign *= -1;
+  }
+  return determinant;
+}
+#endif
+
+//Sets up a view of a whole matrix
+void mxViewMatrix(mxView *write, matrix *read) {
+  write->rows = read->rows;
+  write->columns = read->columns;
+  write->rowStride = MX_SIZE;
+  write->columnStride = 1;
+  write->skipRow = read->rows;
+  write->skipColumn = read->columns;
+  write->elements = read->elements[0];
+}
+
+//Sets up a view of a whole dynamic matrix
+void mxViewDyn(mxView *write, mxDyn *read) {
+  write->rows = read->rows;
+  write->columns = read->columns;
+  write->rowStride = read->stride;
+  write->columnStride = 1;
+  write->skipRow = read->rows;
+  write->skipColumn = read->columns;
+  write->elements = read->elements;
+}
+
+//Sets up a view of a block of another view
+bool mxViewBlock(mxView *write, const mxView *read, int row, int column, int rows, int columns) {
+  //If the block is outside the view
+  if ((row<0)||(column<0)||(rows<0)||(columns<0)) {return false;}
+  if ((row+rows>(int)read->rows)||(column+columns>(int)read->columns)) {return false;}
+
+  //Start the block at its first element (so a left-out row or column above or left of it is already stepped over)
+  mxView m = *read;
+  unsigned int top = row;
+  unsigned int left = column;
+  if (top>=m.skipRow) {top++;}
+  if (left>=m.skipColumn) {left++;}
+  m.elements += top*m.rowStride+left*m.columnStride;
+  //A left-out row or column inside the block is kept, relative to the block
+  m.skipRow = (read->skipRow>(unsigned int)row)? read->skipRow-row:rows;
+  m.skipColumn = (read->skipColumn>(unsigned int)column)? read->skipColumn-column:columns;
+  if (m.skipRow>(unsigned int)rows) {m.skipRow = rows;}
+  if (m.skipColumn>(unsigned int)columns) {m.skipColumn = columns;}
+  m.rows = rows;
+  m.columns = columns;
+  *write = m;
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Sets up a view of a row of another view
+bool mxViewRow(mxView *write, const mxView *read, int index) {
+  return mxViewBlock(write, read, index, 0, 1, read->columns);
+}
+
+//Sets up a view of a column of another view
+bool mxViewColumn(mxView *write, const mxView *read, int index) {
+  return mxViewBlock(write, read, 0, index, read->rows, 1);
+}
+
+//Sets up a view of another view, with a row and a column left out
+bool mxViewMinor(mxView *write, const mxView *read, int row, int column) {
+  //If the row or column is outside the view
+  if ((row<0)||(column<0)||(row>=(int)read->rows)||(column>=(int)read->columns)) {return false;}
+  //If the view already leaves out a row or column
+  if (!((read->skipRow>=read->rows)&&(read->skipColumn>=read->columns))) {return false;}
+
+  //Same elements, with the row and column stepped over
+  *write = *read;
+  write->rows = read->rows-1;
+  write->columns = read->columns-1;
+  write->skipRow = row;
+  write->skipColumn = column;
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Sets up a view of the transpose of another view
+void mxViewTranspose(mxView *write, const mxView *read) {
+  mxView m = *read;
+  m.rows = read->columns;
+  m.columns = read->rows;
+  m.rowStride = read->columnStride;
+  m.columnStride = read->rowStride;
+  m.skipRow = read->skipColumn;
+  m.skipColumn = read->skipRow;
+  *write = m;
+}
+
+//Returns an element from a view
+mxElement_t mxViewReadElement(const mxView *read, int row, int column) {
+  //If the element is outside the view
+  if ((row<0)||(column<0)||(row>=(int)read->rows)||(column>=(int)read->columns)) {return __FAIL;}
+  //Return the element
+  return *mxViewAt(read, row, column);
+}
+
+//Writes an element of a view
+bool mxViewWriteElement(mxView *write, int row, int column, mxElement_t entry) {
+  //If the element is outside the view
+  if ((row<0)||(column<0)||(row>=(int)write->rows)||(column>=(int)write->columns)) {return false;}
+  //Write the element
+  *mxViewAt(write, row, column) = entry;
+  //Indicate that the process was successful
+  return true;
+}
+
+//Adds two views together
+bool mxViewAdd(mxView *write, const mxView *read1, const mxView *read2) {
+  //If the sizes are different
+  if ((read1->rows!=read2->rows)||(read1->columns!=read2->columns)) {return false;}
+  if ((write->rows!=read1->rows)||(write->columns!=read1->columns)) {return false;}
+
+  //If they're all row-major, use the kernel
+  if (mxViewRowMajor(write)&&mxViewRowMajor(read1)&&mxViewRowMajor(read2)) {
+    mxAddKernel(write->elements, write->rowStride, read1->elements, read1->rowStride, read2->elements, read2->rowStride, write->rows, write->columns);
+    return true;
+  }
+  //For each element, add them
+  for (unsigned int r=0; r<write->rows; r++) {
+    for (unsigned int c=0; c<write->columns; c++) {*mxViewAt(write, r, c) = *mxViewAt(read1, r, c)+*mxViewAt(read2, r, c);}
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Multiplies a view by a scalar
+bool mxViewScale(mxView *write, const mxView *read, double factor) {
+  //If the sizes are different
+  if ((write->rows!=read->rows)||(write->columns!=read->columns)) {return false;}
+
+  //If they're both row-major, use the kernel
+  if (mxViewRowMajor(write)&&mxViewRowMajor(read)) {
+    mxScaleKernel(write->elements, write->rowStride, read->elements, read->rowStride, write->rows, write->columns, factor);
+    return true;
+  }
+  //For each element, scale it
+  for (unsigned int r=0; r<write->rows; r++) {
+    for (unsigned int c=0; c<write->columns; c++) {*mxViewAt(write, r, c) = *mxViewAt(read, r, c)*factor;}
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Writes alpha*read1*read2+beta*write, for views
+bool mxViewGemm(mxView *write, double alpha, const mxView *read1, const mxView *read2, double beta) {
+  //If the matrices can't be multiplied
+  if (read1->columns!=read2->rows) {return false;}
+  //If Write is the wrong size
+  if ((write->rows!=read1->rows)||(write->columns!=read2->columns)) {return false;}
+  //If Write shares storage with a matrix being multiplied
+  if ((write->elements==read1->elements)||(write->elements==read2->elements)) {return false;}
+
+  //If they're all row-major, use the kernel
+  if (mxViewRowMajor(write)&&mxViewRowMajor(read1)&&mxViewRowMajor(read2)) {
+    mxGemmKernel(write->elements, write->rowStride, alpha, read1->elements, read1->rowStride, read2->elements, read2->rowStride, beta, write->rows, read1->columns, write->columns, 0);
+    return true;
+  }
+  //For each element of Write
+  for (unsigned int r=0; r<write->rows; r++) {
+    for (unsigned int c=0; c<write->columns; c++) {
+      //Sum the products along the row and column
+      mxElement_t sum = 0;
+      for (unsigned int i=0; i<read1->columns; i++) {sum += (*mxViewAt(read1, r, i))*(*mxViewAt(read2, i, c));}
+      mxElement_t *entry = mxViewAt(write, r, c);
+      *entry = (beta==0)? sum*alpha:sum*alpha+(*entry)*beta;
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Multiplies two views together
+bool mxViewMultiply(mxView *write, const mxView *read1, const mxView *read2) {
+  return mxViewGemm(write, 1, read1, read2, 0);
+}
+
+//Returns the determinant of a square view
+mxElement_t mxViewDeterminant(const mxView *read) {
+  //If it's not a square matrix, or it's too big for the workspace
+  if ((read->rows!=read->columns)||(read->rows>MX_SIZE)) {return __FAIL;}
+  //If there are no elements
+  if (read->rows==0) {return 1;}
+
+#ifdef MX_EXACT
+  //Expand along the rows, marking the columns of each minor instead of copying it
+  bool used[MX_SIZE] = {false};
+  return mxViewExpand(read, 0, used);
+#else
+  //Copy the view into a matrix, and use its determinant
+  matrix m;
+  m.rows = read->rows;
+  m.columns = read->columns;
+  for (unsigned int r=0; r<read->rows; r++) {
+    for (unsigned int c=0; c<read->columns; c++) {m.elements[r][c] = *mxViewAt(read, r, c);}
+  }
+  return mxDeterminant(&m);
+#endif
+}
+
+//Solves for all vectors, using views of the transformation and the resulting vectors
+bool mxViewSolve(mxView *write, const mxView *transform, const mxView *result, mxArena *work) {
+  //If the result is impossible from the transform
+  if (transform->rows!=result->rows) {return false;}
+  //If Write is the wrong size
+  if ((write->rows!=transform->columns)||(write->columns!=result->columns)) {return false;}
+
+  //Take space for copies to do row operations on, and the solution
+  unsigned int used = work->used;
+  mxDyn transform0, result0, solution;
+  if (!(mxDynAlloc(&transform0, work, transform->rows, transform->columns)&&mxDynAlloc(&result0, work, result->rows, result->columns)&&mxDynAlloc(&solution, work, write->rows, write->columns))) {
+    work->used = used;
+    return false;
+  }
+  for (unsigned int r=0; r<transform->rows; r++) {
+    for (unsigned int c=0; c<transform->columns; c++) {transform0.elements[r*transform0.stride+c] = *mxViewAt(transform, r, c);}
+    for (unsigned int c=0; c<result->columns; c++) {result0.elements[r*result0.stride+c] = *mxViewAt(result, r, c);}
+  }
+
+  //Solve, then copy the solution into Write
+  bool success = mxDynSolveGauss(&solution, &transform0, &result0, work);
+  if (success) {
+    for (unsigned int r=0; r<write->rows; r++) {
+      for (unsigned int c=0; c<write->columns; c++) {*mxViewAt(write, r, c) = solution.elements[r*solution.stride+c];}
+    }
+  }
+
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the process was successful
+  return success;
+}
+
+/*================================*/
+/* BATCHES ================================*/
+
+//Number of matrices from a batch that are worked on together (side by side in each row of the working memory)
+#define __LANES 8
+
+//Multiplies each pair of matrices from two arrays
+bool mxMultiplyBatch(matrix *write, const matrix *read1, const matrix *read2, int count) {
+  //If any of the pairs can't be multiplied, nothing is written
+  for (int k=0; k<count; k++) {
+    if (read1[k].columns!=read2[k].rows) {return false;}
+  }
+
+  //For each pair of matrices
+  for (int k=0; k<count; k++) {
+    //Multiply the pair (this only copies a matrix when Write is one of them)
+    mxMultiply(write+k, read1+k, read2+k);
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Inverts each matrix from an array
+bool mxInverseBatch(matrix *write, const matrix *read, int count) {
+  //Whether every matrix was inverted
+  bool success = true;
+  //For each matrix
+  for (int k=0; k<count; k++) {
+    //Invert the matrix, noting any failure
+    if (!mxInverse(write+k, read+k)) {success = false;}
+  }
+  //Indicate whether the process was successful
+  return success;
+}
+
+//Gets the determinant of each matrix from an array
+void mxDeterminantBatch(mxElement_t *write, const matrix *read, int count) {
+  //For each matrix
+  for (int k=0; k<count; k++) {write[k] = mxDeterminant(read+k);}
+}
+
+//Sets up a batch of same-sized matrices over storage
+bool mxBatchInit(mxBatch *write, mxElement_t *storage, int rows, int columns, int count) {
+  //If the size is impossible
+  if ((rows<0)||(columns<0)||(count<0)||(rows>MX_SIZE)||(columns>MX_SIZE)) {return false;}
+
+  //Set the size and storage
+  write->rows = rows;
+  write->columns = columns;
+  write->count = count;
+  write->elements = storage;
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Copies an array of matrices into a batch
+bool mxBatchPack(mxBatch *write, const matrix *read) {
+  //For each matrix
+  for (unsigned int k=0; k<write->count; k++) {
+    //If the matrix is a different size
+    if ((read[k].rows!=write->rows)||(read[k].columns!=write->columns)) {return false;}
+  }
+
+  //For each element position
+  for (unsigned int r=0; r<write->rows; r++) {
+    for (unsigned int c=0; c<write->columns; c++) {
+      //Shorthand for where this element of each matrix is stored
+      mxElement_t *lanes = write->elements+(r*write->columns+c)*write->count;
+      //Copy this element from each matrix
+      for (unsigned int k=0; k<write->count; k++) {lanes[k] = read[k].elements[r][c];}
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Copies a batch into an array of matrices
+void mxBatchUnpack(matrix *write, const mxBatch *read) {
+  //For each matrix
+  for (unsigned int k=0; k<read->count; k++) {
+    //Set the size
+    write[k].rows = read->rows;
+    write[k].columns = read->columns;
+  }
+
+  //For each element position
+  for (unsigned int r=0; r<read->rows; r++) {
+    for (unsigned int c=0; c<read->columns; c++) {
+      //Shorthand for where this element of each matrix is stored
+      const mxElement_t *lanes = read->elements+(r*read->columns+c)*read->count;
+      //Copy this element into each matrix
+      for (unsigned int k=0; k<read->count; k++) {write[k].elements[r][c] = lanes[k];}
+    }
+  }
+}
+
+//Multiplies each pair of matrices from two batches
+bool mxBatchMultiply(mxBatch *write, const mxBatch *read1, const mxBatch *read2) {
+  //If the matrices can't be multiplied
+  if ((read1->columns!=read2->rows)||(read1->count!=read2->count)) {return false;}
+  //If Write is the wrong size
+  if ((write->rows!=read1->rows)||(write->columns!=read2->columns)||(write->count!=read1->count)) {return false;}
+  //If Write shares storage with either batch
+  if ((write->elements==read1->elements)||(write->elements==read2->elements)) {return false;}
+
+  //Shorthand for the sizes
+  unsigned int n = write->count;
+  unsigned int inner = read1->columns;
+  //For each row
+  for (unsigned int r=0; r<write->rows; r++) {
+    //For each column
+    for (unsigned int c=0; c<write->columns; c++) {
+      //This element of every product
+      mxElement_t *sum = write->elements+(r*write->columns+c)*n;
+      for (unsigned int k=0; k<n; k++) {sum[k] = 0;}
+      //For each term
+      for (unsigned int i=0; i<inner; i++) {
+        //This term's elements from every pair of matrices
+        const mxElement_t *a = read1->elements+(r*inner+i)*n;
+        const mxElement_t *b = read2->elements+(i*read2->columns+c)*n;
+        //Increase each sum by its product (every lane does the same operation)
+        for (unsigned int k=0; k<n; k++) {sum[k] += a[k]*b[k];}
+      }
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Moves the largest pivot of each matrix in a group onto the diagonal, optionally swapping the same rows of another group and flipping signs
+static void mxBatchPivot(mxElement_t a[MX_SIZE][MX_SIZE][__LANES], mxElement_t other[MX_SIZE][MX_SIZE][__LANES], mxElement_t *sign, unsigned int n, unsigned int k) {
+  /* Partial pivoting is different for each matrix, so it's done one matrix at a time */
+  //For each matrix in the group
+  for (unsigned int l=0; l<__LANES; l++) {
+    //Search for the largest pivot on or below the diagonal
+    unsigned int p = k;
+    for (unsigned int r=k+1; r<n; r++) {
+      if (__ABS(a[r][k][l])>__ABS(a[p][k][l])) {p = r;}
+    }
+    //If the pivot is already on the diagonal
+    if (p==k) {continue;}
+
+    //Swap the rows of this matrix
+    for (unsigned int c=0; c<n; c++) {
+      mxElement_t temp = a[k][c][l];
+      a[k][c][l] = a[p][c][l];
+      a[p][c][l] = temp;
+    }
+    //Do the same for the other group
+    if (other) {
+      for (unsigned int c=0; c<n; c++) {
+        mxElement_t temp = other[k][c][l];
+        other[k][c][l] = other[p][c][l];
+        other[p][c][l] = temp;
+      }
+    }
+    //A swap changes the sign
+    if (sign) {sign[l] = -sign[l];}
+  }
+}
+
+//Gets the determinant of each matrix from a batch
+bool mxBatchDeterminant(mxElement_t *write, const mxBatch *read) {
+  //If they're not square matrices
+  if (read->rows!=read->columns) {return false;}
+
+  //Shorthand for the sizes
+  unsigned int n = read->rows;
+  unsigned int count = read->count;
+  //Working memory for a group of matrices
+  mxElement_t a[MX_SIZE][MX_SIZE][__LANES];
+
+  //For each group of matrices
+  for (unsigned int k0=0; k0<count; k0+=__LANES) {
+    //The number of matrices in this group
+    unsigned int lanes = (count-k0<__LANES)? count-k0:__LANES;
+    //Copy the group into the working memory (unused lanes are filled with the identity matrix)
+    for (unsigned int r=0; r<n; r++) {
+      for (unsigned int c=0; c<n; c++) {
+        for (unsigned int l=0; l<__LANES; l++) {a[r][c][l] = (l<lanes)? read->elements[(r*n+c)*count+k0+l]:(r==c);}
+      }
+    }
+    //Each determinant starts at 1
+    mxElement_t det[__LANES];
+    for (unsigned int l=0; l<__LANES; l++) {det[l] = 1;}
+
+    /* LU decomposition of every matrix in the group at once */
+    //For each column
+    for (unsigned int k=0; k<n; k++) {
+      //Partial pivoting, which changes the sign of the determinant for each swap
+      mxBatchPivot(a, 0, det, n, k);
+      //Multiply the determinants by the pivots
+      for (unsigned int l=0; l<__LANES; l++) {det[l] *= a[k][k][l];}
+
+      /* Eliminate below the pivots */
+      //For each row below the pivot
+      for (unsigned int r=k+1; r<n; r++) {
+        //The multiple of the pivot row for each matrix (0 where there's no pivot)
+        mxElement_t scalar[__LANES];
+        for (unsigned int l=0; l<__LANES; l++) {scalar[l] = a[r][k][l]/((a[k][k][l]==0)? 1:a[k][k][l]);}
+        //Decrease the row by the multiple of the pivot row
+        for (unsigned int c=k+1; c<n; c++) {
+          mxElement_t *lanes = a[r][c];
+          const mxElement_t *pivotLanes = a[k][c];
+          for (unsigned int l=0; l<__LANES; l++) {lanes[l] -= scalar[l]*pivotLanes[l];}
+        }
+      }
+    }
+
+    //Copy the determinants out of the working memory
+    for (unsigned int l=0; l<lanes; l++) {write[k0+l] = det[l];}
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Inverts each matrix from a batch
+bool mxBatchInverse(mxBatch *write, const mxBatch *read) {
+  //If they're not square matrices
+  if (read->rows!=read->columns) {return false;}
+  //If Write is the wrong size
+  if ((write->rows!=read->rows)||(write->columns!=read->columns)||(write->count!=read->count)) {return false;}
+
+  //Shorthand for the sizes
+  unsigned int n = read->rows;
+  unsigned int count = read->count;
+  //Working memory for a group of matrices, and their inverses
+  mxElement_t a[MX_SIZE][MX_SIZE][__LANES];
+  mxElement_t inv[MX_SIZE][MX_SIZE][__LANES];
+  //Whether every matrix was inverted
+  bool success = true;
+
+  //For each group of matrices
+  for (unsigned int k0=0; k0<count; k0+=__LANES) {
+    //The number of matrices in this group
+    unsigned int lanes = (count-k0<__LANES)? count-k0:__LANES;
+    //Copy the group into the working memory (unused lanes are filled with the identity matrix), and start each inverse as the identity matrix
+    for (unsigned int r=0; r<n; r++) {
+      for (unsigned int c=0; c<n; c++) {
+        for (unsigned int l=0; l<__LANES; l++) {
+          a[r][c][l] = (l<lanes)? read->elements[(r*n+c)*count+k0+l]:(r==c);
+          inv[r][c][l] = (r==c)? 1:0;
+        }
+      }
+    }
+
+    /* Gauss-Jordan elimination of every matrix in the group at once */
+    //For each column
+    for (unsigned int k=0; k<n; k++) {
+      //Partial pivoting, swapping the same rows of the inverses
+      mxBatchPivot(a, inv, 0, n, k);
+      //The reciprocal of each pivot
+      mxElement_t reciprocal[__LANES];
+      for (unsigned int l=0; l<lanes; l++) {
+        //If there is no non-zero pivot, this matrix can't be inverted
+        if (a[k][k][l]==0) {success = false;}
+      }
+      for (unsigned int l=0; l<__LANES; l++) {reciprocal[l] = (a[k][k][l]==0)? 0:1/a[k][k][l];}
+
+      //Divide the pivot rows by the pivots
+      for (unsigned int c=0; c<n; c++) {
+        for (unsigned int l=0; l<__LANES; l++) {a[k][c][l] *= reciprocal[l];}
+        for (unsigned int l=0; l<__LANES; l++) {inv[k][c][l] *= reciprocal[l];}
+      }
+      //For each other row
+      for (unsigned int r=0; r<n; r++) {
+        //If this row is the pivot
+        if (r==k) {continue;}
+        //The multiple of the pivot row for each matrix
+        mxElement_t scalar[__LANES];
+        for (unsigned int l=0; l<__LANES; l++) {scalar[l] = a[r][k][l];}
+        //Decrease the row by the multiple of the pivot row
+        for (unsigned int c=0; c<n; c++) {
+          mxElement_t *lanes = a[r][c];
+          const mxElement_t *pivotLanes = a[k][c];
+          for (unsigned int l=0; l<__LANES; l++) {lanes[l] -= scalar[l]*pivotLanes[l];}
+          lanes = inv[r][c];
+          pivotLanes = inv[k][c];
+          for (unsigned int l=0; l<__LANES; l++) {lanes[l] -= scalar[l]*pivotLanes[l];}
+        }
+      }
+    }
+
+    //Copy the inverses out of the working memory
+    for (unsigned int r=0; r<n; r++) {
+      for (unsigned int c=0; c<n; c++) {
+        for (unsigned int l=0; l<lanes; l++) {write->elements[(r*n+c)*count+k0+l] = inv[r][c][l];}
+      }
+    }
+  }
+
+  //Indicate whether the process was successful
+  return success;
+}
+
+/*================================*/
+/* SPARSE MATRICES ================================*/
+
+//Sets up an empty (zero) sparse matrix over storage
+bool mxSparseInit(mxSparse *write, unsigned int *rowStart, unsigned int *columnIndices, mxElement_t *elements, int capacity, int rows, int columns) {
+  //If the size is impossible
+  if ((rows<0)||(columns<0)||(capacity<0)) {return false;}
+
+  //Set the size and storage
+  write->rows = rows;
+  write->columns = columns;
+  write->capacity = capacity;
+  write->rowStart = rowStart;
+  write->columnIndices = columnIndices;
+  write->elements = elements;
+  //Start with no stored elements
+  for (unsigned int r=0; r<=write->rows; r++) {rowStart[r] = 0;}
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Sets up an empty (zero) sparse matrix with storage taken from an arena
+bool mxSparseAlloc(mxSparse *write, mxArena *arena, int rows, int columns, int capacity) {
+  //If the size is impossible
+  if ((rows<0)||(columns<0)||(capacity<0)) {return false;}
+
+  //Take the storage
+  unsigned int used = arena->used;
+  unsigned int *rowStart = mxArenaAllocIndices(arena, rows+1);
+  unsigned int *columnIndices = mxArenaAllocIndices(arena, capacity);
+  mxElement_t *elements = mxArenaAlloc(arena, capacity);
+  //If there is not enough space left, give back whatever was taken
+  if ((rowStart==0)||(columnIndices==0)||(elements==0)) {
+    arena->used = used;
+    return false;
+  }
+
+  return mxSparseInit(write, rowStart, columnIndices, elements, capacity, rows, columns);
+}
+
+//Fills a sparse matrix from (row, column, value) triplets, in any order
+bool mxSparseFromTriplets(mxSparse *write, const unsigned int *rowIndices, const unsigned int *columnIndices, const mxElement_t *values, int count) {
+  //If there are more triplets than storage
+  if ((count<0)||(count>write->capacity)) {return false;}
+  //If any of the triplets are out of bounds
+  for (unsigned int k=0; k<count; k++) {
+    if ((rowIndices[k]>=write->rows)||(columnIndices[k]>=write->columns)) {return false;}
+  }
+
+  //Shorthand for the storage
+  unsigned int rows = write->rows;
+  unsigned int *start = write->rowStart;
+  unsigned int *column = write->columnIndices;
+  mxElement_t *value = write->elements;
+
+  /* Counting sort of the triplets by row */
+  //Count the triplets in each row (one place along)
+  for (unsigned int r=0; r<=rows; r++) {start[r] = 0;}
+  for (unsigned int k=0; k<count; k++) {start[rowIndices[k]+1]++;}
+  //Add up the counts to get the start of each row
+  for (unsigned int r=0; r<rows; r++) {start[r+1] += start[r];}
+  //Place each triplet, using the start of its row as a cursor (which moves to the start of the next row)
+  for (unsigned int k=0; k<count; k++) {
+    unsigned int i = start[rowIndices[k]]++;
+    column[i] = columnIndices[k];
+    value[i] = values[k];
+  }
+  //Move the starts back to their own rows
+  for (unsigned int r=rows; r>0; r--) {start[r] = start[r-1];}
+  start[0] = 0;
+
+  /* Sort each row by column, and add together triplets in the same position */
+  unsigned int nonzeros = 0;
+  //For each row
+  for (unsigned int r=0; r<rows; r++) {
+    //Get the placed triplets of this row, before its start is moved
+    unsigned int first = start[r];
+    unsigned int last = start[r+1];
+    start[r] = nonzeros;
+    //Insertion sort by column (rows are usually short)
+    for (unsigned int i=first+1; i<last; i++) {
+      unsigned int keyColumn = column[i];
+      mxElement_t keyValue = value[i];
+      unsigned int j = i;
+      while ((j>first)&&(column[j-1]>keyColumn)) {
+        column[j] = column[j-1];
+        value[j] = value[j-1];
+        j--;
+      }
+      column[j] = keyColumn;
+      value[j] = keyValue;
+    }
+    //Pack the row down, adding together triplets in the same position
+    for (unsigned int i=first; i<last; i++) {
+      if ((nonzeros>start[r])&&(column[nonzeros-1]==column[i])) {
+        value[nonzeros-1] += value[i];
+      } else {
+        column[nonzeros] = column[i];
+        value[nonzeros] = value[i];
+        nonzeros++;
+      }
+    }
+  }
+  start[rows] = nonzeros;
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Fills a sparse matrix with the non-zero elements of row-major elements
+static bool mxSparseFromDense(mxSparse *write, const mxElement_t *read, unsigned int readStride, unsigned int rows, unsigned int columns) {
+  //If the sizes are different
+  if ((write->rows!=rows)||(write->columns!=columns)) {return false;}
+  //Count the non-zero elements
+  unsigned int nonzeros = 0;
+  for (unsigned int r=0; r<rows; r++) {
+    for (unsigned int c=0; c<columns; c++) {
+      if (read[r*readStride+c]!=0) {nonzeros++;}
+    }
+  }
+  //If there's not enough storage
+  if (nonzeros>write->capacity) {return false;}
+
+  //For each row
+  nonzeros = 0;
+  for (unsigned int r=0; r<rows; r++) {
+    write->rowStart[r] = nonzeros;
+    //Store each non-zero element
+    for (unsigned int c=0; c<columns; c++) {
+      if (read[r*readStride+c]!=0) {
+        write->columnIndices[nonzeros] = c;
+        write->elements[nonzeros] = read[r*readStride+c];
+        nonzeros++;
+      }
+    }
+  }
+  write->rowStart[rows] = nonzeros;
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Writes a sparse matrix into row-major elements
+static void mxSparseToDense(mxElement_t *write, unsigned int writeStride, const mxSparse *read) {
+  //For each row
+  for (unsigned int r=0; r<read->rows; r++) {
+    //Clear the row
+    for (unsigned int c=0; c<read->columns; c++) {write[r*writeStride+c] = 0;}
+    //Place the stored elements
+    for (unsigned int i=read->rowStart[r]; i<read->rowStart[r+1]; i++) {
+      write[r*writeStride+read->columnIndices[i]] = read->elements[i];
+    }
+  }
+}
+
+//Fills a sparse matrix with the non-zero elements of a matrix of the same size
+bool mxSparseFromMatrix(mxSparse *write, const matrix *read) {
+  return mxSparseFromDense(write, read->elements[0], MX_SIZE, read->rows, read->columns);
+}
+
+//Fills a sparse matrix with the non-zero elements of a dynamic matrix of the same size
+bool mxSparseFromDyn(mxSparse *write, const mxDyn *read) {
+  return mxSparseFromDense(write, read->elements, read->stride, read->rows, read->columns);
+}
+
+//Copies a sparse matrix into a matrix
+bool mxSparseToMatrix(matrix *write, const mxSparse *read) {
+  //If the sparse matrix is too large
+  if ((read->rows>MX_SIZE)||(read->columns>MX_SIZE)) {return false;}
+
+  //Setting the size
+  write->rows = read->rows;
+  write->columns = read->columns;
+  //Copy the elements
+  mxSparseToDense(write->elements[0], MX_SIZE, read);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Copies a sparse matrix into a dynamic matrix of the same size
+bool mxSparseToDyn(mxDyn *write, const mxSparse *read) {
+  //If the sizes are different
+  if ((write->rows!=read->rows)||(write->columns!=read->columns)) {return false;}
+  //Copy the elements
+  mxSparseToDense(write->elements, write->stride, read);
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Transposes a sparse matrix (which also turns its row-by-row storage into column-by-column storage)
+bool mxSparseTranspose(mxSparse *write, const mxSparse *read) {
+  //If Write is the wrong size
+  if ((write->rows!=read->columns)||(write->columns!=read->rows)) {return false;}
+  //If Write shares storage with Read
+  if ((write->rowStart==read->rowStart)||(write->elements==read->elements)) {return false;}
+  //If there's not enough storage
+  if (read->rowStart[read->rows]>write->capacity) {return false;}
+
+  /* Counting sort of the elements by column */
+  unsigned int *start = write->rowStart;
+  //Count the elements in each column (one place along)
+  for (unsigned int c=0; c<=write->rows; c++) {start[c] = 0;}
+  for (unsigned int i=0; i<read->rowStart[read->rows]; i++) {start[read->columnIndices[i]+1]++;}
+  //Add up the counts to get the start of each row of Write
+  for (unsigned int c=0; c<write->rows; c++) {start[c+1] += start[c];}
+  //Place each element, going through Read's rows in order (so each row of Write stays sorted)
+  for (unsigned int r=0; r<read->rows; r++) {
+    for (unsigned int i=read->rowStart[r]; i<read->rowStart[r+1]; i++) {
+      unsigned int j = start[read->columnIndices[i]]++;
+      write->columnIndices[j] = r;
+      write->elements[j] = read->elements[i];
+    }
+  }
+  //Move the starts back to their own rows
+  for (unsigned int c=write->rows; c>0; c--) {start[c] = start[c-1];}
+  start[0] = 0;
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Multiplies a sparse matrix by a vector
+void mxSparseMultiplyVector(mxElement_t *write, const mxSparse *read, const mxElement_t *vector) {
+  //For each row
+  for (unsigned int r=0; r<read->rows; r++) {
+    //Add up the stored elements multiplied by the matching entries of the vector
+    mxElement_t sum = 0;
+    for (unsigned int i=read->rowStart[r]; i<read->rowStart[r+1]; i++) {sum += read->elements[i]*vector[read->columnIndices[i]];}
+    write[r] = sum;
+  }
+}
+
+//Multiplies a sparse matrix by a dynamic matrix
+bool mxSparseMultiplyDyn(mxDyn *write, const mxSparse *read1, const mxDyn *read2) {
+  //If the matrices can't be multiplied
+  if (read1->columns!=read2->rows) {return false;}
+  //If Write is the wrong size
+  if ((write->rows!=read1->rows)||(write->columns!=read2->columns)) {return false;}
+  //If Write shares storage with the dynamic matrix
+  if (write->elements==read2->elements) {return false;}
+
+  //Whether the rows can be added with SIMD
+  bool simd = __MX_DOUBLE&&(mxSimdPath()!=MX_SIMD_SCALAR);
+  unsigned int columns = read2->columns;
+  //For each row
+  for (unsigned int r=0; r<read1->rows; r++) {
+    mxElement_t *row = write->elements+r*write->stride;
+    //Clear the row
+    for (unsigned int c=0; c<columns; c++) {row[c] = 0;}
+    //Add the multiple of the matching row of the dynamic matrix, for each stored element
+    for (unsigned int i=read1->rowStart[r]; i<read1->rowStart[r+1]; i++) {
+      mxElement_t scalar = read1->elements[i];
+      const mxElement_t *other = read2->elements+read1->columnIndices[i]*read2->stride;
+      if (simd) {
+        mxSimdAxpy((double*)row, scalar, (const double*)other, columns);
+      } else {
+        for (unsigned int c=0; c<columns; c++) {row[c] += scalar*other[c];}
+      }
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Orders the rows (and columns) of a symmetric sparse matrix to keep them close to the diagonal
+bool mxSparseOrderRCM(unsigned int *write, const mxSparse *read, mxArena *work) {
+  //If it's not a square matrix
+  if (read->rows!=read->columns) {return false;}
+
+  //Shorthand for the size and storage
+  unsigned int n = read->rows;
+  const unsigned int *start = read->rowStart;
+  const unsigned int *column = read->columnIndices;
+  //Take the workspace: how far each row has been visited (0 not yet, 1 by a trial search, 2 ordered)
+  unsigned int used = work->used;
+  unsigned int *visited = mxArenaAllocIndices(work, n);
+  if (visited==0) {return false;}
+  for (unsigned int i=0; i<n; i++) {visited[i] = 0;}
+
+  /* Cuthill-McKee: a breadth-first search, where each row's new neighbours are taken fewest-entries first.
+  Write holds the ordered rows, and is also the queue of the search */
+  unsigned int tail = 0;
+  //While rows are left (one search per connected group of rows)
+  while (tail<n) {
+    //Find the unvisited row with the fewest entries
+    unsigned int root = n;
+    for (unsigned int i=0; i<n; i++) {
+      if ((visited[i]==0)&&((root==n)||(start[i+1]-start[i]<start[root+1]-start[root]))) {root = i;}
+    }
+
+    /* A trial search from that row, to start from a row at the far edge of the group instead */
+    unsigned int head = tail;
+    unsigned int end = tail;
+    write[end++] = root;
+    visited[root] = 1;
+    while (head<end) {
+      unsigned int row = write[head++];
+      for (unsigned int i=start[row]; i<start[row+1]; i++) {
+        if (visited[column[i]]==0) {
+          visited[column[i]] = 1;
+          write[end++] = column[i];
+        }
+      }
+    }
+    //The last row found is one of the furthest away
+    root = write[end-1];
+    //Forget the trial search
+    for (unsigned int i=tail; i<end; i++) {visited[write[i]] = 0;}
+
+    /* The ordering search */
+    head = tail;
+    write[tail++] = root;
+    visited[root] = 2;
+    while (head<tail) {
+      unsigned int row = write[head++];
+      unsigned int first = tail;
+      //Add each unvisited neighbour
+      for (unsigned int i=start[row]; i<start[row+1]; i++) {
+        if (visited[column[i]]==0) {
+          visited[column[i]] = 2;
+          write[tail++] = column[i];
+        }
+      }
+      //Sort the new neighbours by their number of entries (insertion sort)
+      for (unsigned int i=first+1; i<tail; i++) {
+        unsigned int key = write[i];
+        unsigned int j = i;
+        while ((j>first)&&(start[write[j-1]+1]-start[write[j-1]]>start[key+1]-start[key])) {
+          write[j] = write[j-1];
+          j--;
+        }
+        write[j] = key;
+      }
+    }
+  }
+
+  //Reverse the ordering (which usually gives less fill-in when decomposing)
+  for (unsigned int i=0; i<n/2; i++) {
+    unsigned int temp = write[i];
+    write[i] = write[n-1-i];
+    write[n-1-i] = temp;
+  }
+
+  //Give back the workspace
+  work->used = used;
+  //Indicate that the process was successful
+  return true;
+}
+
+/* In the following helpers, the reordered matrix is C = P*A*P', where row k of C is row permutation[k] of A.
+The entries of column k of C's upper triangle are found from row permutation[k] of A, because A is symmetric */
+
+//Finds the pattern of row k of L, by following the elimination tree up from each entry of column k of C.
+//The pattern is written into stack[top..n-1], and the new top is returned
+static unsigned int mxSparseReach(const mxSparseFactor *factor, const mxSparse *read, unsigned int k, unsigned int *stack, unsigned int *flag) {
+  unsigned int n = factor->size;
+  unsigned int top = n;
+  //Mark the diagonal, so that the paths stop there
+  flag[k] = k;
+  //For each entry of row permutation[k] of A
+  unsigned int row = factor->permutation[k];
+  for (unsigned int p=read->rowStart[row]; p<read->rowStart[row+1]; p++) {
+    unsigned int i = factor->inverse[read->columnIndices[p]];
+    //If it's below the diagonal of C, it isn't in the upper triangle
+    if (i>k) {continue;}
+    //Follow the path up the tree until a marked column (using the bottom of the stack)
+    unsigned int length = 0;
+    for (; flag[i]!=k; i=factor->parent[i]) {
+      stack[length++] = i;
+      flag[i] = k;
+    }
+    //Push the path onto the top of the stack
+    while (length>0) {stack[--top] = stack[--length];}
+  }
+  //Return the top of the stack
+  return top;
+}
+
+//Decomposes a symmetric positive-definite sparse matrix, into a reordering and a lower triangular matrix
+bool mxSparseCholesky(mxSparseFactor *write, const mxSparse *read, mxArena *storage) {
+  //If it's not a square matrix
+  if (read->rows!=read->columns) {return false;}
+
+  //Shorthand for the size
+  unsigned int n = read->rows;
+  write->size = n;
+  write->valid = false;
+  //Take the storage for the ordering and the tree
+  unsigned int used = storage->used;
+  write->permutation = mxArenaAllocIndices(storage, n);
+  write->inverse = mxArenaAllocIndices(storage, n);
+  write->parent = mxArenaAllocIndices(storage, n);
+  write->columnStart = mxArenaAllocIndices(storage, n+1);
+  //If there is not enough space left
+  if ((write->permutation==0)||(write->inverse==0)||(write->parent==0)||(write->columnStart==0)) {
+    storage->used = used;
+    return false;
+  }
+
+  /* Reorder the rows and columns to reduce the fill-in */
+  if (!mxSparseOrderRCM(write->permutation, read, storage)) {
+    storage->used = used;
+    return false;
+  }
+  for (unsigned int k=0; k<n; k++) {write->inverse[write->permutation[k]] = k;}
+
+  /* Symbolic analysis: the elimination tree, then the number of entries in each column of L */
+  //Take the workspace
+  unsigned int workStart = storage->used;
+  unsigned int *ancestor = mxArenaAllocIndices(storage, n);
+  unsigned int *stack = mxArenaAllocIndices(storage, n);
+  unsigned int *flag = mxArenaAllocIndices(storage, n);
+  if ((ancestor==0)||(stack==0)||(flag==0)) {
+    storage->used = used;
+    return false;
+  }
+  //For each column of C
+  for (unsigned int k=0; k<n; k++) {
+    //It has no parent or ancestor yet
+    write->parent[k] = n;
+    ancestor[k] = n;
+    //For each entry above the diagonal of column k
+    unsigned int row = write->permutation[k];
+    for (unsigned int p=read->rowStart[row]; p<read->rowStart[row+1]; p++) {
+      unsigned int next;
+      //Climb from the entry's row to the root of its current tree, pointing each step at k
+      for (unsigned int i=write->inverse[read->columnIndices[p]]; (i!=n)&&(i<k); i=next) {
+        next = ancestor[i];
+        ancestor[i] = k;
+        //The root becomes a child of k
+        if (next==n) {write->parent[i] = k;}
+      }
+    }
+  }
+  //Count the entries of each column of L (one place along), from the pattern of each row
+  for (unsigned int k=0; k<=n; k++) {write->columnStart[k] = 0;}
+  for (unsigned int k=0; k<n; k++) {flag[k] = n;}
+  for (unsigned int k=0; k<n; k++) {
+    for (unsigned int top=mxSparseReach(write, read, k, stack, flag); top<n; top++) {write->columnStart[stack[top]+1]++;}
+    //The diagonal entry
+    write->columnStart[k+1]++;
+  }
+  //Add up the counts to get the start of each column
+  for (unsigned int k=0; k<n; k++) {write->columnStart[k+1] += write->columnStart[k];}
+  //Give back the workspace
+  storage->used = workStart;
+
+  //Take the storage for L
+  write->rowIndices = mxArenaAllocIndices(storage, write->columnStart[n]);
+  write->elements = mxArenaAlloc(storage, write->columnStart[n]);
+  if ((write->rowIndices==0)||(write->elements==0)) {
+    storage->used = used;
+    return false;
+  }
+
+  /* Numeric decomposition */
+  if (!mxSparseCholeskyRefactor(write, read, storage)) {
+    storage->used = used;
+    return false;
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Decomposes a sparse matrix again, reusing the ordering and storage of a decomposition of a matrix with the same pattern
+bool mxSparseCholeskyRefactor(mxSparseFactor *write, const mxSparse *read, mxArena *work) {
+  //If the size is different
+  if ((read->rows!=write->size)||(read->columns!=write->size)) {return false;}
+
+  //Shorthand for the size and L
+  unsigned int n = write->size;
+  const unsigned int *start = write->columnStart;
+  unsigned int *row = write->rowIndices;
+  mxElement_t *value = write->elements;
+  //The decomposition isn't usable until it's finished
+  write->valid = false;
+
+  //Take the workspace
+  unsigned int used = work->used;
+  unsigned int *cursor = mxArenaAllocIndices(work, n);
+  unsigned int *stack = mxArenaAllocIndices(work, n);
+  unsigned int *flag = mxArenaAllocIndices(work, n);
+  mxElement_t *x = mxArenaAlloc(work, n);
+  if ((cursor==0)||(stack==0)||(flag==0)||(x==0)) {
+    work->used = used;
+    return false;
+  }
+  for (unsigned int k=0; k<n; k++) {
+    cursor[k] = start[k];
+    flag[k] = n;
+    x[k] = 0;
+  }
+
+  /* Up-looking decomposition: row k of L is solved from the rows above it */
+  bool success = true;
+  for (unsigned int k=0; k<n; k++) {
+    //Find the pattern of row k of L
+    unsigned int top = mxSparseReach(write, read, k, stack, flag);
+    //Scatter column k of C's upper triangle into x
+    unsigned int original = write->permutation[k];
+    for (unsigned int p=read->rowStart[original]; p<read->rowStart[original+1]; p++) {
+      unsigned int i = write->inverse[read->columnIndices[p]];
+      if (i<=k) {x[i] += read->elements[p];}
+    }
+    //Start the diagonal from C's diagonal
+    mxElement_t diagonal = x[k];
+    x[k] = 0;
+    //For each entry in the pattern of row k, in the order the tree gives
+    for (; top<n; top++) {
+      unsigned int i = stack[top];
+      //Solve for the entry L[k][i] (the diagonal entry is first in column i)
+      mxElement_t entry = x[i]/value[start[i]];
+      x[i] = 0;
+      //Update the rest of row k, using the rest of column i
+      for (unsigned int p=start[i]+1; p<cursor[i]; p++) {x[row[p]] -= value[p]*entry;}
+      diagonal -= entry*entry;
+      //If the pattern is different from the one the storage was made for
+      if (cursor[i]>=start[i+1]) {
+        success = false;
+        break;
+      }
+      //Store the entry in column i
+      row[cursor[i]] = k;
+      value[cursor[i]] = entry;
+      cursor[i]++;
+    }
+    //If the matrix isn't positive-definite (or the pattern is different)
+    if ((!success)||(diagonal<=0)||(cursor[k]>=start[k+1])) {
+      success = false;
+      break;
+    }
+    //Store the diagonal entry, first in column k
+    row[cursor[k]] = k;
+    value[cursor[k]] = sqrt(diagonal);
+    cursor[k]++;
+  }
+
+  //Give back the workspace
+  work->used = used;
+  //The decomposition can be used to solve, if it was finished
+  write->valid = success;
+  //Indicate whether the process was successful
+  return success;
+}
+
+//Solves for a vector, using a sparse decomposition of the transformation matrix
+bool mxSparseCholeskySolve(mxElement_t *write, const mxSparseFactor *factor, const mxElement_t *result, mxArena *work) {
+  //If the decomposition can't be used
+  if (!factor->valid) {return false;}
+
+  //Shorthand for the size and L
+  unsigned int n = factor->size;
+  const unsigned int *start = factor->columnStart;
+  const unsigned int *row = factor->rowIndices;
+  const mxElement_t *value = factor->elements;
+  //Take the workspace
+  unsigned int used = work->used;
+  mxElement_t *x = mxArenaAlloc(work, n);
+  if (x==0) {return false;}
+
+  //Reorder the resulting vector
+  for (unsigned int k=0; k<n; k++) {x[k] = result[factor->permutation[k]];}
+  //Forward substitution with L (column by column)
+  for (unsigned int j=0; j<n; j++) {
+    x[j] /= value[start[j]];
+    for (unsigned int p=start[j]+1; p<start[j+1]; p++) {x[row[p]] -= value[p]*x[j];}
+  }
+  //Backward substitution with L' (column by column of L is row by row of L')
+  for (unsigned int j=n; j-->0;) {
+    for (unsigned int p=start[j]+1; p<start[j+1]; p++) {x[j] -= value[p]*x[row[p]];}
+    x[j] /= value[start[j]];
+  }
+  //Undo the reordering into Write
+  for (unsigned int k=0; k<n; k++) {write[factor->permutation[k]] = x[k];}
+
+  //Give back the workspace
+  work->used = used;
+  //Indicate that the process was successful
+  return true;
+}
+
+/*================================*/
+/* BANDED MATRICES ================================*/
+
+//Sets up a zero banded matrix over storage
+bool mxBandInit(mxBand *write, mxElement_t *storage, int size, int lower, int upper) {
+  //If the size is impossible
+  if ((size<0)||(lower<0)||(upper<0)) {return false;}
+
+  //Set the size and storage (with room for the extra upper diagonals that row swaps make)
+  write->size = size;
+  write->lower = lower;
+  write->upper = upper;
+  write->stride = 2*lower+upper+1;
+  write->elements = storage;
+  //Start with every element zero
+  for (unsigned int i=0; i<write->size*write->stride; i++) {storage[i] = 0;}
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Sets up a zero banded matrix with storage taken from an arena
+bool mxBandAlloc(mxBand *write, mxArena *arena, int size, int lower, int upper) {
+  //If the size is impossible
+  if ((size<0)||(lower<0)||(upper<0)) {return false;}
+  //Take the storage
+  mxElement_t *storage = mxArenaAlloc(arena, size*(2*lower+upper+1));
+  if (storage==0) {return false;}
+  //Set up the banded matrix
+  return mxBandInit(write, storage, size, lower, upper);
+}
+
+//Returns an element from a banded matrix (zero outside the band)
+mxElement_t mxBandReadElement(const mxBand *read, int row, int column) {
+  //If the element is outside the matrix, or outside the band
+  if ((row<0)||(column<0)||(row>=(int)read->size)||(column>=(int)read->size)) {return 0;}
+  if ((column<row-(int)read->lower)||(column>row+(int)read->upper)) {return 0;}
+  //Return the element
+  return read->elements[row*(read->stride-1)+read->lower+column];
+}
+
+//Writes an element of a banded matrix
+bool mxBandWriteElement(mxBand *write, int row, int column, mxElement_t entry) {
+  //If the element is outside the matrix, or outside the band
+  if ((row<0)||(column<0)||(row>=(int)write->size)||(column>=(int)write->size)) {return false;}
+  if ((column<row-(int)write->lower)||(column>row+(int)write->upper)) {return false;}
+  //Write the element
+  write->elements[row*(write->stride-1)+write->lower+column] = entry;
+  //Indicate that the process was successful
+  return true;
+}
+
+//Multiplies a banded matrix by a vector
+void mxBandMultiplyVector(mxElement_t *write, const mxBand *read, const mxElement_t *vector) {
+  //For each row
+  for (unsigned int r=0; r<read->size; r++) {
+    //The columns of the band in this row
+    unsigned int first = (r>read->lower)? r-read->lower:0;
+    unsigned int last = (r+read->upper<read->size)? r+read->upper:read->size-1;
+    const mxElement_t *row = read->elements+r*(read->stride-1)+read->lower;
+    //Sum the products along the row
+    mxElement_t sum = 0;
+    for (unsigned int c=first; c<=last; c++) {sum += row[c]*vector[c];}
+    write[r] = sum;
+  }
+}
+
+//Decomposes a banded matrix into L*U in place, using partial pivoting
+bool mxBandLU(mxBand *write, unsigned int *pivots) {
+  //Shorthand for the size
+  unsigned int n = write->size;
+  unsigned int kl = write->lower;
+  //Rows can reach this many columns past the diagonal, once rows are swapped
+  unsigned int reach = write->upper+kl;
+
+  //For each column
+  for (unsigned int k=0; k<n; k++) {
+    //Row k, offset so that it can be indexed by column
+    mxElement_t *pivotRow = write->elements+k*(write->stride-1)+kl;
+    //The rows that have an element in this column
+    unsigned int bottom = (k+kl<n)? k+kl:n-1;
+    unsigned int right = (k+reach<n)? k+reach:n-1;
+
+    /* Swap the row with the largest pivot into place */
+    unsigned int largest = k;
+    for (unsigned int r=k+1; r<=bottom; r++) {
+      if (__ABS(write->elements[r*(write->stride-1)+kl+k])>__ABS(write->elements[largest*(write->stride-1)+kl+k])) {largest = r;}
+    }
+    pivots[k] = largest;
+    if (largest!=k) {
+      mxElement_t *other = write->elements+largest*(write->stride-1)+kl;
+      for (unsigned int c=k; c<=right; c++) {
+        mxElement_t temp = pivotRow[c];
+        pivotRow[c] = other[c];
+        other[c] = temp;
+      }
+    }
+    //If the matrix is singular
+    if (pivotRow[k]==0) {return false;}
+
+    /* Eliminate the column below the pivot, keeping the multipliers in its place */
+    for (unsigned int r=k+1; r<=bottom; r++) {
+      mxElement_t *row = write->elements+r*(write->stride-1)+kl;
+      mxElement_t scalar = row[k]/pivotRow[k];
+      row[k] = scalar;
+      for (unsigned int c=k+1; c<=right; c++) {row[c] -= scalar*pivotRow[c];}
+    }
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Solves for a vector, using a banded LU decomposition of the transformation matrix
+bool mxBandLUSolve(mxElement_t *write, const mxBand *factor, const unsigned int *pivots, const mxElement_t *result) {
+  //Shorthand for the size
+  unsigned int n = factor->size;
+  unsigned int kl = factor->lower;
+  unsigned int reach = factor->upper+kl;
+  //Start Write as a copy of the result (it's solved in place)
+  if (write!=result) {
+    for (unsigned int i=0; i<n; i++) {write[i] = result[i];}
+  }
+
+  /* Forward substitution with L, swapping rows the same way as the decomposition */
+  for (unsigned int k=0; k<n; k++) {
+    //Swap the rows
+    if (pivots[k]!=k) {
+      mxElement_t temp = write[k];
+      write[k] = write[pivots[k]];
+      write[pivots[k]] = temp;
+    }
+    //Subtract the multiples of this row
+    unsigned int bottom = (k+kl<n)? k+kl:n-1;
+    for (unsigned int r=k+1; r<=bottom; r++) {write[r] -= factor->elements[r*(factor->stride-1)+kl+k]*write[k];}
+  }
+
+  /* Backward substitution with U */
+  for (unsigned int i=n; i-->0;) {
+    const mxElement_t *row = factor->elements+i*(factor->stride-1)+kl;
+    //If the matrix is singular
+    if (row[i]==0) {return false;}
+    unsigned int right = (i+reach<n)? i+reach:n-1;
+    mxElement_t entry = write[i];
+    for (unsigned int c=i+1; c<=right; c++) {entry -= row[c]*write[c];}
+    write[i] = entry/row[i];
+  }
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Solves for a vector with a tridiagonal transformation, using the Thomas algorithm (without pivoting)
+bool mxSolveTridiagonal(mxElement_t *write, const mxElement_t *lower, const mxElement_t *diagonal, const mxElement_t *upper, const mxElement_t *result, int size, mxArena *work) {
+  //If the size is impossible
+  if (size<=0) {return size==0;}
+  //Take space for the modified upper diagonal
+  unsigned int used = work->used;
+  mxElement_t *modified = mxArenaAlloc(work, size);
+  if (modified==0) {return false;}
+
+  /* Forward sweep: eliminate the lower diagonal, so each row only has its diagonal (now 1) and upper entry */
+  bool success = true;
+  mxElement_t pivot = diagonal[0];
+  for (int i=0; i<size; i++) {
+    if (i>0) {pivot = diagonal[i]-lower[i-1]*modified[i-1];}
+    //If there's a zero pivot
+    if (pivot==0) {
+      success = false;
+      break;
+    }
+    if (i+1<size) {modified[i] = upper[i]/pivot;}
+    write[i] = ((i>0)? result[i]-lower[i-1]*write[i-1]:result[i])/pivot;
+  }
+  /* Backward sweep */
+  if (success) {
+    for (int i=size-1; i-->0;) {write[i] -= modified[i]*write[i+1];}
+  }
+
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the process was successful
+  return success;
+}
+
+//Solves for a vector in each of many tridiagonal systems at once, stored so that the same entry of each system is side by side
+bool mxSolveTridiagonalBatch(mxElement_t *write, const mxElement_t *lower, const mxElement_t *diagonal, const mxElement_t *upper, const mxElement_t *result, int size, int count, mxArena *work) {
+  //If the size is impossible
+  if ((size<0)||(count<0)) {return false;}
+  if ((size==0)||(count==0)) {return true;}
+  //Take space for the modified upper diagonals
+  unsigned int used = work->used;
+  mxElement_t *modified = mxArenaAlloc(work, size*count);
+  if (modified==0) {return false;}
+  unsigned int lanes = count;
+
+  /* The same sweeps as mxSolveTridiagonal, but each step is done for every system in a row (which vectorises) */
+  bool success = true;
+  for (unsigned int i=0; i<(unsigned int)size; i++) {
+    mxElement_t *x = write+i*lanes;
+    mxElement_t *m = modified+i*lanes;
+    const mxElement_t *d = diagonal+i*lanes;
+    const mxElement_t *b = result+i*lanes;
+    //For each system
+    for (unsigned int k=0; k<lanes; k++) {
+      mxElement_t pivot = d[k];
+      mxElement_t entry = b[k];
+      if (i>0) {
+        pivot -= lower[(i-1)*lanes+k]*modified[(i-1)*lanes+k];
+        entry -= lower[(i-1)*lanes+k]*write[(i-1)*lanes+k];
+      }
+      //If there's a zero pivot, divide by 1 instead (so the lanes stay in step, and integer elements don't trap), and report the failure afterwards
+      if (pivot==0) {
+        success = false;
+        pivot = 1;
+      }
+      if (i+1<(unsigned int)size) {m[k] = upper[i*lanes+k]/pivot;}
+      x[k] = entry/pivot;
+    }
+  }
+  if (success) {
+    for (unsigned int i=size-1; i-->0;) {
+      mxElement_t *x = write+i*lanes;
+      const mxElement_t *m = modified+i*lanes;
+      for (unsigned int k=0; k<lanes; k++) {x[k] -= m[k]*x[k+lanes];}
+    }
+  }
+
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the process was successful
+  return success;
+}
+
+/*================================*/
+/* ITERATIVE SOLVERS ================================*/
+
+//Returns the dot product of two vectors
+static mxElement_t mxVectorDot(const mxElement_t *read1, const mxElement_t *read2, unsigned int length) {
+  mxElement_t sum = 0;
+  for (unsigned int i=0; i<length; i++) {sum += read1[i]*read2[i];}
+  return sum;
+}
+
+//Increases a vector by a multiple of another vector
+static void mxVectorAxpy(mxElement_t *write, mxElement_t scalar, const mxElement_t *read, unsigned int length) {
+  //If possible, use the SIMD path
+  if (__MX_DOUBLE&&(mxSimdPath()!=MX_SIMD_SCALAR)) {
+    mxSimdAxpy((double*)write, scalar, (const double*)read, length);
+    return;
+  }
+  for (unsigned int i=0; i<length; i++) {write[i] += scalar*read[i];}
+}
+
+//Applies the preconditioner from the settings (or copies the vector, if there isn't one)
+static void mxPrecondition(const mxKrylovSettings *settings, mxElement_t *write, const mxElement_t *vector, unsigned int length) {
+  if (settings->preconditioner!=0) {
+    settings->preconditioner(write, vector, settings->preconditionerContext);
+    return;
+  }
+  for (unsigned int i=0; i<length; i++) {write[i] = vector[i];}
+}
+
+//Fills in the report with the relative residual of the solution (using 'r' as workspace)
+static void mxKrylovFinish(mxKrylovReport *report, mxOperator transform, void *context, const mxElement_t *x, const mxElement_t *b, mxElement_t *r, unsigned int n, mxElement_t bNorm, unsigned int iterations, bool converged) {
+  //If there's nowhere to report to
+  if (report==0) {return;}
+  //r = b-A*x
+  transform(r, x, context);
+  for (unsigned int i=0; i<n; i++) {r[i] = b[i]-r[i];}
+  report->iterations = iterations;
+  report->residual = sqrt(mxVectorDot(r, r, n))/bNorm;
+  report->converged = converged;
+}
+
+//Fills in settings with the defaults
+void mxKrylovDefaults(mxKrylovSettings *write) {
+  write->tolerance = 1e-10;
+  write->maxIterations = 1000;
+  write->restart = 30;
+  write->preconditioner = 0;
+  write->preconditionerContext = 0;
+}
+
+//Multiplies a matrix by a vector, for the iterative solvers
+void mxOperatorMatrix(mxElement_t *write, const mxElement_t *vector, void *context) {
+  const matrix *read = (const matrix*)context;
+  //For each row
+  for (unsigned int r=0; r<read->rows; r++) {
+    mxElement_t sum = 0;
+    for (unsigned int c=0; c<read->columns; c++) {sum += read->elements[r][c]*vector[c];}
+    write[r] = sum;
+  }
+}
+
+//Multiplies a dynamic matrix by a vector, for the iterative solvers
+void mxOperatorDyn(mxElement_t *write, const mxElement_t *vector, void *context) {
+  const mxDyn *read = (const mxDyn*)context;
+  //For each row
+  for (unsigned int r=0; r<read->rows; r++) {
+    const mxElement_t *row = read->elements+r*read->stride;
+    mxElement_t sum = 0;
+    for (unsigned int c=0; c<read->columns; c++) {sum += row[c]*vector[c];}
+    write[r] = sum;
+  }
+}
+
+//Multiplies a sparse matrix by a vector, for the iterative solvers
+void mxOperatorSparse(mxElement_t *write, const mxElement_t *vector, void *context) {
+  mxSparseMultiplyVector(write, (const mxSparse*)context, vector);
+}
+
+//Sets up a Jacobi preconditioner (dividing by the diagonal) for a sparse matrix
+bool mxJacobiInit(mxJacobi *write, const mxSparse *read, mxArena *arena) {
+  //If the matrix is not square
+  if (read->rows!=read->columns) {return false;}
+  //Take the storage
+  mxElement_t *inverse = mxArenaAlloc(arena, read->rows);
+  if (inverse==0) {return false;}
+
+  //Find the inverse of each diagonal element
+  for (unsigned int r=0; r<read->rows; r++) {
+    inverse[r] = 0;
+    for (unsigned int i=read->rowStart[r]; i<read->rowStart[r+1]; i++) {
+      if (read->columnIndices[i]==r) {inverse[r] += read->elements[i];}
+    }
+    //If the diagonal element is zero
+    if (inverse[r]==0) {return false;}
+    inverse[r] = 1/inverse[r];
+  }
+  write->size = read->rows;
+  write->inverseDiagonal = inverse;
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Applies a Jacobi preconditioner to a vector
+void mxJacobiApply(mxElement_t *write, const mxElement_t *vector, void *context) {
+  const mxJacobi *read = (const mxJacobi*)context;
+  for (unsigned int i=0; i<read->size; i++) {write[i] = read->inverseDiagonal[i]*vector[i];}
+}
+
+//Sets up an incomplete LU preconditioner for a sparse matrix, with no fill (ILU(0))
+bool mxILUInit(mxILU *write, const mxSparse *read, mxArena *arena) {
+  //If the matrix is not square
+  if (read->rows!=read->columns) {return false;}
+  //Take the storage, and copy the matrix (the decomposition keeps the same pattern)
+  unsigned int n = read->rows;
+  unsigned int count = read->rowStart[n];
+  unsigned int used = arena->used;
+  unsigned int *diagonal = mxArenaAllocIndices(arena, n);
+  unsigned int *position = mxArenaAllocIndices(arena, n);
+  if ((diagonal==0)||(position==0)||!mxSparseAlloc(&write->lu, arena, n, n, count)) {
+    arena->used = used;
+    return false;
+  }
+  mxSparse *lu = &write->lu;
+  for (unsigned int r=0; r<=n; r++) {lu->rowStart[r] = read->rowStart[r];}
+  for (unsigned int i=0; i<count; i++) {
+    lu->columnIndices[i] = read->columnIndices[i];
+    lu->elements[i] = read->elements[i];
+  }
+  //Find each row's diagonal element
+  for (unsigned int r=0; r<n; r++) {
+    diagonal[r] = count;
+    for (unsigned int i=lu->rowStart[r]; i<lu->rowStart[r+1]; i++) {
+      if (lu->columnIndices[i]==r) {diagonal[r] = i;}
+    }
+    //If the diagonal element is missing
+    if (diagonal[r]==count) {
+      arena->used = used;
+      return false;
+    }
+    position[r] = count;
+  }
+
+  /* Gauss elimination, row by row, but only updating the elements that are already stored */
+  for (unsigned int r=0; r<n; r++) {
+    //Mark where each column of this row is stored
+    for (unsigned int i=lu->rowStart[r]; i<lu->rowStart[r+1]; i++) {position[lu->columnIndices[i]] = i;}
+    //For each element left of the diagonal (in order)
+    for (unsigned int i=lu->rowStart[r]; i<diagonal[r]; i++) {
+      unsigned int k = lu->columnIndices[i];
+      //If the pivot is zero
+      if (lu->elements[diagonal[k]]==0) {
+        arena->used = used;
+        return false;
+      }
+      //The multiplier
+      mxElement_t scalar = lu->elements[i]/lu->elements[diagonal[k]];
+      lu->elements[i] = scalar;
+      //Subtract the multiple of row k, right of its diagonal, where this row has elements
+      for (unsigned int j=diagonal[k]+1; j<lu->rowStart[k+1]; j++) {
+        unsigned int at = position[lu->columnIndices[j]];
+        if (at!=count) {lu->elements[at] -= scalar*lu->elements[j];}
+      }
+    }
+    //Clear the marks
+    for (unsigned int i=lu->rowStart[r]; i<lu->rowStart[r+1]; i++) {position[lu->columnIndices[i]] = count;}
+    //If the pivot is zero
+    if (lu->elements[diagonal[r]]==0) {
+      arena->used = used;
+      return false;
+    }
+  }
+  write->diagonal = diagonal;
+
+  //Indicate that the process was successful
+  return true;
+}
+
+//Applies an incomplete LU preconditioner to a vector (solving L*U*write = vector)
+void mxILUApply(mxElement_t *write, const mxElement_t *vector, void *context) {
+  const mxILU *read = (const mxILU*)context;
+  const mxSparse *lu = &read->lu;
+  //Forward substitution with L (which has 1s on its diagonal)
+  for (unsigned int r=0; r<lu->rows; r++) {
+    mxElement_t entry = vector[r];
+    for (unsigned int i=lu->rowStart[r]; i<read->diagonal[r]; i++) {entry -= lu->elements[i]*write[lu->columnIndices[i]];}
+    write[r] = entry;
+  }
+  //Backward substitution with U
+  for (unsigned int r=lu->rows; r-->0;) {
+    mxElement_t entry = write[r];
+    for (unsigned int i=read->diagonal[r]+1; i<lu->rowStart[r+1]; i++) {entry -= lu->elements[i]*write[lu->columnIndices[i]];}
+    write[r] = entry/lu->elements[read->diagonal[r]];
+  }
+}
+
+//Solves for a vector with a symmetric positive-definite operator, using the (preconditioned) conjugate gradient method
+bool mxSolveCG(mxElement_t *write, mxOperator transform, void *context, const mxElement_t *result, int size, const mxKrylovSettings *settings, mxKrylovReport *report, mxArena *work) {
+  //If the size is impossible
+  if (size<0) {return false;}
+  //Take the workspace: the residual, the preconditioned residual, the search direction, and its product
+  unsigned int n = size;
+  unsigned int used = work->used;
+  mxElement_t *r = mxArenaAlloc(work, n);
+  mxElement_t *z = mxArenaAlloc(work, n);
+  mxElement_t *p = mxArenaAlloc(work, n);
+  mxElement_t *q = mxArenaAlloc(work, n);
+  if ((r==0)||(z==0)||(p==0)||(q==0)) {
+    work->used = used;
+    return false;
+  }
+  //If the result is zero, so is the solution
+  mxElement_t bNorm = sqrt(mxVectorDot(result, result, n));
+  if (bNorm==0) {
+    for (unsigned int i=0; i<n; i++) {write[i] = 0;}
+    if (report!=0) {
+      report->iterations = 0;
+      report->residual = 0;
+      report->converged = true;
+    }
+    work->used = used;
+    return true;
+  }
+
+  //r = b-A*x, starting from the guess in Write
+  transform(r, write, context);
+  for (unsigned int i=0; i<n; i++) {r[i] = result[i]-r[i];}
+  mxPrecondition(settings, z, r, n);
+  for (unsigned int i=0; i<n; i++) {p[i] = z[i];}
+  mxElement_t rz = mxVectorDot(r, z, n);
+
+  /* Each step moves along a search direction that is A-orthogonal to all the previous ones */
+  unsigned int iterations = 0;
+  bool converged = sqrt(mxVectorDot(r, r, n))<=settings->tolerance*bNorm;
+  while (!converged&&(iterations<settings->maxIterations)) {
+    iterations++;
+    //Step along p, as far as it reduces the error
+    transform(q, p, context);
+    mxElement_t pq = mxVectorDot(p, q, n);
+    //If the operator isn't positive-definite
+    if (pq<=0) {break;}
+    mxElement_t alpha = rz/pq;
+    mxVectorAxpy(write, alpha, p, n);
+    mxVectorAxpy(r, -alpha, q, n);
+    //If the residual is small enough
+    if (sqrt(mxVectorDot(r, r, n))<=settings->tolerance*bNorm) {
+      converged = true;
+      break;
+    }
+    //The next search direction
+    mxPrecondition(settings, z, r, n);
+    mxElement_t rzNext = mxVectorDot(r, z, n);
+    mxElement_t beta = rzNext/rz;
+    rz = rzNext;
+    for (unsigned int i=0; i<n; i++) {p[i] = z[i]+beta*p[i];}
+  }
+
+  //Report the true residual
+  mxKrylovFinish(report, transform, context, write, result, r, n, bNorm, iterations, converged);
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the solver converged
+  return converged;
+}
+
+//Solves for a vector with any square operator, using the (right-preconditioned) BiCGSTAB method
+bool mxSolveBiCGSTAB(mxElement_t *write, mxOperator transform, void *context, const mxElement_t *result, int size, const mxKrylovSettings *settings, mxKrylovReport *report, mxArena *work) {
+  //If the size is impossible
+  if (size<0) {return false;}
+  //Take the workspace
+  unsigned int n = size;
+  unsigned int used = work->used;
+  mxElement_t *r = mxArenaAlloc(work, n);
+  mxElement_t *shadow = mxArenaAlloc(work, n);
+  mxElement_t *p = mxArenaAlloc(work, n);
+  mxElement_t *v = mxArenaAlloc(work, n);
+  mxElement_t *pHat = mxArenaAlloc(work, n);
+  mxElement_t *sHat = mxArenaAlloc(work, n);
+  mxElement_t *t = mxArenaAlloc(work, n);
+  if ((r==0)||(shadow==0)||(p==0)||(v==0)||(pHat==0)||(sHat==0)||(t==0)) {
+    work->used = used;
+    return false;
+  }
+  //If the result is zero, so is the solution
+  mxElement_t bNorm = sqrt(mxVectorDot(result, result, n));
+  if (bNorm==0) {
+    for (unsigned int i=0; i<n; i++) {write[i] = 0;}
+    if (report!=0) {
+      report->iterations = 0;
+      report->residual = 0;
+      report->converged = true;
+    }
+    work->used = used;
+    return true;
+  }
+
+  //r = b-A*x, starting from the guess in Write, and the shadow residual is kept fixed
+  transform(r, write, context);
+  for (unsigned int i=0; i<n; i++) {
+    r[i] = result[i]-r[i];
+    shadow[i] = r[i];
+    p[i] = 0;
+    v[i] = 0;
+  }
+  mxElement_t rho = 1;
+  mxElement_t alpha = 1;
+  mxElement_t omega = 1;
+
+  /* Each step is a BiCG step, followed by a one-dimensional minimisation of the residual */
+  unsigned int iterations = 0;
+  bool converged = sqrt(mxVectorDot(r, r, n))<=settings->tolerance*bNorm;
+  while (!converged&&(iterations<settings->maxIterations)) {
+    iterations++;
+    mxElement_t rhoNext = mxVectorDot(shadow, r, n);
+    //If the method breaks down
+    if ((rhoNext==0)||(omega==0)) {break;}
+    mxElement_t beta = (rhoNext/rho)*(alpha/omega);
+    rho = rhoNext;
+    //p = r+beta*(p-omega*v)
+    for (unsigned int i=0; i<n; i++) {p[i] = r[i]+beta*(p[i]-omega*v[i]);}
+    mxPrecondition(settings, pHat, p, n);
+    transform(v, pHat, context);
+    mxElement_t shadowV = mxVectorDot(shadow, v, n);
+    if (shadowV==0) {break;}
+    alpha = rho/shadowV;
+    //s = r-alpha*v (kept in r)
+    mxVectorAxpy(r, -alpha, v, n);
+    mxVectorAxpy(write, alpha, pHat, n);
+    //If the half step is good enough
+    if (sqrt(mxVectorDot(r, r, n))<=settings->tolerance*bNorm) {
+      converged = true;
+      break;
+    }
+    //Minimise the residual along A*M*s
+    mxPrecondition(settings, sHat, r, n);
+    transform(t, sHat, context);
+    mxElement_t tt = mxVectorDot(t, t, n);
+    if (tt==0) {break;}
+    omega = mxVectorDot(t, r, n)/tt;
+    mxVectorAxpy(write, omega, sHat, n);
+    mxVectorAxpy(r, -omega, t, n);
+    //If the residual is small enough
+    if (sqrt(mxVectorDot(r, r, n))<=settings->tolerance*bNorm) {converged = true;}
+  }
+
+  //Report the true residual
+  mxKrylovFinish(report, transform, context, write, result, r, n, bNorm, iterations, converged);
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the solver converged
+  return converged;
+}
+
+//Solves for a vector with any square operator, using the restarted (right-preconditioned) GMRES method
+bool mxSolveGMRES(mxElement_t *write, mxOperator transform, void *context, const mxElement_t *result, int size, const mxKrylovSettings *settings, mxKrylovReport *report, mxArena *work) {
+  //If the size is impossible
+  if ((size<0)||(settings->restart==0)) {return false;}
+  //Take the workspace: the basis, the Hessenberg matrix, the rotations, and two vectors
+  unsigned int n = size;
+  unsigned int m = settings->restart;
+  unsigned int used = work->used;
+  mxElement_t *basis = mxArenaAlloc(work, (m+1)*n);
+  mxElement_t *h = mxArenaAlloc(work, (m+1)*m);
+  mxElement_t *cosines = mxArenaAlloc(work, m);
+  mxElement_t *sines = mxArenaAlloc(work, m);
+  mxElement_t *g = mxArenaAlloc(work, m+1);
+  mxElement_t *w = mxArenaAlloc(work, n);
+  mxElement_t *z = mxArenaAlloc(work, n);
+  if ((basis==0)||(h==0)||(cosines==0)||(sines==0)||(g==0)||(w==0)||(z==0)) {
+    work->used = used;
+    return false;
+  }
+  //If the result is zero, so is the solution
+  mxElement_t bNorm = sqrt(mxVectorDot(result, result, n));
+  if (bNorm==0) {
+    for (unsigned int i=0; i<n; i++) {write[i] = 0;}
+    if (report!=0) {
+      report->iterations = 0;
+      report->residual = 0;
+      report->converged = true;
+    }
+    work->used = used;
+    return true;
+  }
+
+  unsigned int iterations = 0;
+  bool converged = false;
+  /* Each cycle builds an orthonormal basis of the Krylov space (Arnoldi), and picks the combination with the least residual */
+  while (!converged) {
+    //r = b-A*x, which starts the basis
+    mxElement_t *v0 = basis;
+    transform(v0, write, context);
+    for (unsigned int i=0; i<n; i++) {v0[i] = result[i]-v0[i];}
+    mxElement_t beta = sqrt(mxVectorDot(v0, v0, n));
+    if (beta<=settings->tolerance*bNorm) {
+      converged = true;
+      break;
+    }
+    //If there are no iterations left
+    if (iterations>=settings->maxIterations) {break;}
+    for (unsigned int i=0; i<n; i++) {v0[i] /= beta;}
+    g[0] = beta;
+
+    //For each new basis vector
+    unsigned int k = 0;
+    while ((k<m)&&(iterations<settings->maxIterations)) {
+      iterations++;
+      //w = A*M*v
+      mxPrecondition(settings, z, basis+k*n, n);
+      transform(w, z, context);
+      //Make it orthogonal to the basis (modified Gram-Schmidt)
+      for (unsigned int i=0; i<=k; i++) {
+        h[i*m+k] = mxVectorDot(w, basis+i*n, n);
+        mxVectorAxpy(w, -h[i*m+k], basis+i*n, n);
+      }
+      mxElement_t length = sqrt(mxVectorDot(w, w, n));
+      h[(k+1)*m+k] = length;
+      if (length!=0) {
+        for (unsigned int i=0; i<n; i++) {basis[(k+1)*n+i] = w[i]/length;}
+      }
+      //Apply the previous rotations to the new column
+      for (unsigned int i=0; i<k; i++) {
+        mxElement_t upper = h[i*m+k];
+        mxElement_t lower = h[(i+1)*m+k];
+        h[i*m+k] = cosines[i]*upper+sines[i]*lower;
+        h[(i+1)*m+k] = -sines[i]*upper+cosines[i]*lower;
+      }
+      //Make a rotation that zeroes the entry below the diagonal
+      mxElement_t radius = hypot(h[k*m+k], h[(k+1)*m+k]);
+      cosines[k] = (radius==0)? 1:h[k*m+k]/radius;
+      sines[k] = (radius==0)? 0:h[(k+1)*m+k]/radius;
+      h[k*m+k] = radius;
+      h[(k+1)*m+k] = 0;
+      g[k+1] = -sines[k]*g[k];
+      g[k] *= cosines[k];
+      k++;
+      //The residual of the best combination is left in g
+      if ((__ABS(g[k])<=settings->tolerance*bNorm)||(length==0)) {break;}
+    }
+
+    /* Solve the small triangular system, then x = x+M*(basis*y) */
+    for (unsigned int i=k; i-->0;) {
+      mxElement_t entry = g[i];
+      for (unsigned int j=i+1; j<k; j++) {entry -= h[i*m+j]*g[j];}
+      g[i] = (h[i*m+i]==0)? 0:entry/h[i*m+i];
+    }
+    for (unsigned int i=0; i<n; i++) {w[i] = 0;}
+    for (unsigned int j=0; j<k; j++) {mxVectorAxpy(w, g[j], basis+j*n, n);}
+    mxPrecondition(settings, z, w, n);
+    mxVectorAxpy(write, 1, z, n);
+  }
+
+  //Report the true residual
+  mxKrylovFinish(report, transform, context, write, result, w, n, bNorm, iterations, converged);
+  //Give the space back to the arena
+  work->used = used;
+  //Indicate whether the solver converged
+  return converged;
+}
+
+/*================================*/
+/* SIMD ================================*/
+
+//The SIMD path that was detected (or -1 if it hasn't been detected yet)
+static int mxSimdActive = -1;
+
+//Returns the SIMD path that the element loops use
+mxSimd mxSimdPath(void) {
+  //If the path hasn't been detected yet
+  if (mxSimdActive<0) {
+    //Start with no SIMD
+    int path = MX_SIMD_SCALAR;
+#if defined(__MX_AVX2)&&defined(__GNUC__)&&!(defined(__AVX2__)&&defined(__FMA__))
+    //Check if this CPU supports AVX2 (and FMA)
+    __builtin_cpu_init();
+    path = (__builtin_cpu_supports("avx2")&&__builtin_cpu_supports("fma"))? MX_SIMD_AVX2:MX_SIMD_SSE2;
+#elif defined(__MX_AVX2)
+    //The compiler was told the CPU supports AVX2
+    path = MX_SIMD_AVX2;
+#elif defined(__MX_SSE2)
+    path = MX_SIMD_SSE2;
+#elif defined(__MX_NEON)
+    path = MX_SIMD_NEON;
+#endif
+    //If the elements aren't doubles, the SIMD kernels can't be used
+    if (!__MX_DOUBLE) {path = MX_SIMD_SCALAR;}
+    mxSimdActive = path;
+  }
+  return (mxSimd)mxSimdActive;
+}
+
+//Returns the name of the SIMD path that the element loops use
+const char *mxSimdPathName(void) {
+  switch (mxSimdPath()) {
+    case MX_SIMD_SSE2: return "SSE2";
+    case MX_SIMD_AVX2: return "AVX2";
+    case MX_SIMD_NEON: return "NEON";
+    default: return "scalar";
+  }
+}
+
 /*================================*/
 
 #undef __FAIL
-#undef __INF_SOLUTIONS
\ No newline at end of file
+#undef __INF_SOLUTIONS
+#undef __ABS
+#undef __SVD_TOLERANCE
+#undef __FIXED_PACK
+#undef __MX_NOINLINE
+#undef __TRANSPOSE_LEAF
+#undef __MR
+#undef __NR
+#undef __LANES
+#undef __MX_DOUBLE
+#ifdef __MX_SSE2
+  #undef __MX_SSE2
+#endif
+#ifdef __MX_AVX2
+  #undef __MX_AVX2
+  #undef __MX_AVX2_TARGET
+#endif
+#ifdef __MX_NEON
+  #undef __MX_NEON
+#endif
\ No newline at end of file
@@ -1,7 +1,7 @@
 // Matrices Library, for matrix operations
 // Header file
 // by Neo Vorsatz
-// Last updated: 27 December 2025
+// Last updated: 16 October 2026
 
 //Header guard
 #ifndef MATRICES_H
@@ -27,6 +27,53 @@
   typedef double mxElement_t; //This type determines the numerical data type of the matrices
 #endif
 
+#ifndef MX_GEMM_MC
+  #define MX_GEMM_MC 32 //This value determines how many rows are multiplied per cache block
+#endif
+
+#ifndef MX_GEMM_KC
+  #define MX_GEMM_KC 128 //This value determines how many terms are multiplied per cache block
+#endif
+
+#ifndef MX_GEMM_THRESHOLD
+  #define MX_GEMM_THRESHOLD 32768 //Multiplications with more multiply-adds than this use cache blocks
+#endif
+
+//Number of elements that large multiplications pack their blocks into (the register tile is 4 by 8), taken from the arena by mxDynGemm
+#define MX_GEMM_PACK ((((MX_GEMM_MC)+3)/4)*4*(MX_GEMM_KC)+(MX_GEMM_KC)*8)
+
+#ifndef MX_RESTRICT
+  #if defined(__cplusplus)
+    #define MX_RESTRICT __restrict //This keyword promises the compiler that pointers don't share storage
+  #elif defined(__STDC_VERSION__) && (__STDC_VERSION__>=199901L)
+    #define MX_RESTRICT restrict
+  #else
+    #define MX_RESTRICT
+  #endif
+#endif
+
+#ifndef MX_QR_BLOCK
+  #define MX_QR_BLOCK 32 //This value determines how many columns are decomposed per block by mxDynQR
+#endif
+
+//Define MX_SVD_TOLERANCE to fix how small singular values (relative to the largest) must be to count as zero in pseudo-inverses and ranks
+//(by default, the larger side of the matrix times the machine epsilon of the element type)
+#ifndef MX_SVD_OVERSAMPLE
+  #define MX_SVD_OVERSAMPLE 10 //This value determines how many extra random samples mxDynSVD_top takes
+#endif
+#ifndef MX_SVD_POWER
+  #define MX_SVD_POWER 2 //This value determines how many power iterations mxDynSVD_top does
+#endif
+
+#ifndef MX_REFINE_STEPS
+  #define MX_REFINE_STEPS 10 //This value determines the most refinement steps mxSolveRefined takes for each vector
+#endif
+
+//Define MX_NO_SIMD to only use the portable (scalar) element loops
+
+//Define MX_EXACT to keep the exact cofactor and adjoint algorithms (for integer or symbolic element types)
+
+
 /*================================*/
 /* TYPE DEFINITIONS ================================*/
 
@@ -37,6 +84,133 @@ typedef struct {
   mxElement_t elements[MX_SIZE][MX_SIZE];
 } matrix;
 
+//Structure for an LU decomposition (with partial pivoting) of a square matrix
+typedef struct {
+  matrix lu; //unit lower triangle (below the diagonal) and upper triangle (on and above the diagonal), packed
+  unsigned int permutation[MX_SIZE]; //row of the original matrix that each row of the decomposition came from
+  signed int sign; //sign of the permutation (+1 or -1)
+  bool valid; //whether the decomposition is up to date and can be used to solve
+} mxLUFactor;
+
+//Structure for a QR decomposition (using Householder reflections) of a matrix with at least as many rows as columns
+typedef struct {
+  matrix qr; //upper triangle R (on and above the diagonal), and the reflectors (below the diagonal, without their leading 1s)
+  mxElement_t tau[MX_SIZE]; //scale of each reflector, where the reflector is I-tau*v*v'
+} mxQRFactor;
+
+//Structure for what a refined solve reports back
+typedef struct {
+  double solution[MX_SIZE][MX_SIZE]; //the solution in double precision, before it was rounded into the elements
+  unsigned int iterations; //most refinement steps taken for any one vector
+  double residual; //largest entry of the final residual (result-transform*solution, found in double), as a fraction of the largest entry of the result
+  bool converged; //whether every vector's residual reached the level of double rounding
+} mxRefineReport;
+
+//SIMD paths that the element loops can take
+typedef enum {
+  MX_SIMD_SCALAR, //portable loops, one element at a time
+  MX_SIMD_SSE2, //x86, 2 doubles at a time
+  MX_SIMD_AVX2, //x86, 4 doubles at a time (with fused multiply-add)
+  MX_SIMD_NEON //ARM 64-bit, 2 doubles at a time
+} mxSimd;
+
+//Structure for matrices with a size chosen at runtime, over storage provided by the user
+typedef struct {
+  unsigned int rows;
+  unsigned int columns;
+  unsigned int stride; //number of elements between the starts of consecutive rows
+  mxElement_t *elements; //pointer to the first element, with rows stored one after another
+} mxDyn;
+
+//Structure for a view of part of a matrix (a block, row, column, minor or transpose), which uses the matrix's elements without copying them
+typedef struct {
+  unsigned int rows;
+  unsigned int columns;
+  unsigned int rowStride; //number of elements between consecutive rows
+  unsigned int columnStride; //number of elements between consecutive columns
+  unsigned int skipRow; //row of the view that is stepped over, for minors (at least 'rows' if none)
+  unsigned int skipColumn; //column of the view that is stepped over, for minors (at least 'columns' if none)
+  mxElement_t *elements; //pointer to the first element
+} mxView;
+
+//Structure for a batch of same-sized matrices, stored so that the same element of each matrix is side by side
+typedef struct {
+  unsigned int rows;
+  unsigned int columns;
+  unsigned int count; //number of matrices
+  mxElement_t *elements; //element [r][c] of matrix k is at elements[(r*columns+c)*count+k]
+} mxBatch;
+
+//Structure for a sparse matrix in compressed sparse row form, over storage provided by the user
+typedef struct {
+  unsigned int rows;
+  unsigned int columns;
+  unsigned int capacity; //number of elements the storage can hold
+  unsigned int *rowStart; //rows+1 entries: the elements of row r are at [rowStart[r], rowStart[r+1]), so rowStart[rows] is the number stored
+  unsigned int *columnIndices; //column of each stored element (in order within each row)
+  mxElement_t *elements; //value of each stored element
+} mxSparse;
+
+//Structure for a sparse Cholesky decomposition (P*A*P' = L*L') of a symmetric positive-definite sparse matrix
+typedef struct {
+  unsigned int size;
+  unsigned int *permutation; //row of the original matrix at each position of the reordering (P)
+  unsigned int *inverse; //position in the reordering of each row of the original matrix
+  unsigned int *parent; //parent of each column in the elimination tree (size if it's a root)
+  unsigned int *columnStart; //size+1 entries: the entries of column j of L are at [columnStart[j], columnStart[j+1])
+  unsigned int *rowIndices; //row of each stored entry of L (the diagonal entry is first in its column)
+  mxElement_t *elements; //value of each stored entry of L
+  bool valid; //whether the decomposition is finished and can be used to solve
+} mxSparseFactor;
+
+//Structure for a banded matrix, whose non-zero elements are within 'lower' diagonals below and 'upper' diagonals above the main diagonal
+typedef struct {
+  unsigned int size; //number of rows and columns
+  unsigned int lower; //number of diagonals below the main diagonal
+  unsigned int upper; //number of diagonals above the main diagonal
+  unsigned int stride; //2*lower+upper+1 elements per row: the band, and room for 'lower' more diagonals made by row swaps in mxBandLU
+  mxElement_t *elements; //element [r][c] is at elements[r*(stride-1)+lower+c]
+} mxBand;
+
+//Function that multiplies an operator by a vector (write = A*vector), for the iterative solvers.
+//The context points to whatever the operator needs, such as a matrix
+typedef void (*mxOperator)(mxElement_t *write, const mxElement_t *vector, void *context);
+
+//Structure for the settings of an iterative solver
+typedef struct {
+  mxElement_t tolerance; //the solver stops when the length of the residual (result-A*write) is this fraction of the length of the result
+  unsigned int maxIterations; //the solver stops after this many iterations (each is one multiplication by the operator, or two for BiCGSTAB)
+  unsigned int restart; //number of basis vectors GMRES builds before it restarts
+  mxOperator preconditioner; //applies an approximate inverse of the operator (or null for none)
+  void *preconditionerContext; //passed to the preconditioner
+} mxKrylovSettings;
+
+//Structure for what an iterative solver reports back
+typedef struct {
+  unsigned int iterations; //number of iterations taken
+  mxElement_t residual; //length of the final residual, as a fraction of the length of the result
+  bool converged; //whether the residual reached the tolerance
+} mxKrylovReport;
+
+//Structure for a Jacobi preconditioner, which divides by the diagonal of a matrix
+typedef struct {
+  unsigned int size;
+  mxElement_t *inverseDiagonal; //inverse of each diagonal element
+} mxJacobi;
+
+//Structure for an incomplete LU preconditioner (ILU(0)), with the same pattern of elements as its sparse matrix
+typedef struct {
+  mxSparse lu; //the multipliers of L left of the diagonal (its diagonal is 1s), and U on and right of the diagonal
+  unsigned int *diagonal; //index of each row's diagonal element
+} mxILU;
+
+//Structure for an arena, which hands out storage from a buffer provided by the user
+typedef struct {
+  mxElement_t *buffer; //pointer to the buffer
+  unsigned int size; //number of elements in the buffer
+  unsigned int used; //number of elements handed out
+} mxArena;
+
 /*================================*/
 /* WRITING ================================*/
 
@@ -314,6 +488,14 @@ bool mxAdd(matrix *write, const matrix *read1, const matrix *read2);
  */
 void mxScale(matrix *write, const matrix *read, double factor);
 
+/**
+ * @brief Scales/Multiplies the given matrix by a factor, in place
+ * 
+ * @param write A pointer to the matrix
+ * @param factor The value of the factor/scalar
+ */
+void mxScale_inplace(matrix *write, double factor);
+
 /**
  * @brief Multiplies two matrices
  * 
@@ -325,6 +507,32 @@ void mxScale(matrix *write, const matrix *read, double factor);
  */
 bool mxMultiply(matrix *write, const matrix *read1, const matrix *read2);
 
+/**
+ * @brief Multiplies two matrices, without copying them first
+ * 
+ * 'write' must not be either of the matrices being multiplied
+ * 
+ * @param write A pointer to where the result will be written
+ * @param read1 A pointer to the first matrix (transformation)
+ * @param read2 A pointer to the second matrix (vector)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxMultiply_noalias(matrix *MX_RESTRICT write, const matrix *MX_RESTRICT read1, const matrix *MX_RESTRICT read2);
+
+/**
+ * @brief Multiplies two matrices, and accumulates them into a scaled Write (write = alpha*read1*read2 + beta*write)
+ * 
+ * @param write A pointer to where the result will be written (must not be either of the matrices being multiplied)
+ * @param alpha The scalar of the product
+ * @param read1 A pointer to the first matrix (transformation)
+ * @param read2 A pointer to the second matrix (vector)
+ * @param beta The scalar of Write's existing elements (if 0, they're ignored)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxGemm(matrix *write, double alpha, const matrix *read1, const matrix *read2, double beta);
+
 /**
  * @param read A pointer to the matrix
  * 
@@ -341,6 +549,24 @@ mxElement_t mxDeterminant(const matrix *read);
  */
 void mxTranspose(matrix *write, const matrix *read);
 
+/**
+ * @brief Transposes the given matrix, without copying it first.
+ * The storage is split in half recursively, so the pieces fit in cache whatever its size
+ * 
+ * 'write' must not be the same matrix
+ * 
+ * @param write A pointer to where the result will be written
+ * @param read A pointer to the matrix
+ */
+void mxTranspose_noalias(matrix *MX_RESTRICT write, const matrix *MX_RESTRICT read);
+
+/**
+ * @brief Transposes the given matrix, in place (without a temporary matrix), using the same recursive split as mxTranspose_noalias
+ * 
+ * @param write A pointer to the matrix
+ */
+void mxTranspose_inplace(matrix *write);
+
 /**
  * @brief Gets the adjoint of the given matrix
  * 
@@ -352,7 +578,7 @@ void mxTranspose(matrix *write, const matrix *read);
 bool mxAdjoint(matrix *write, const matrix *read);
 
 /**
- * @brief Inverts the given matrix
+ * @brief Inverts the given matrix, using Gauss-Jordan elimination
  * 
  * @param write A pointer to where the result will be written
  * @param read A pointer to the matrix
@@ -361,6 +587,33 @@ bool mxAdjoint(matrix *write, const matrix *read);
  */
 bool mxInverse(matrix *write, const matrix *read);
 
+/**
+ * @brief Inverts the given matrix, using the adjoint and the determinant
+ * 
+ * This is slower, but suits integer or symbolic element types (see MX_EXACT)
+ * 
+ * @param write A pointer to where the result will be written
+ * @param read A pointer to the matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxInverse_adj(matrix *write, const matrix *read);
+
+/**
+ * @brief Updates an inverse to the inverse of the matrix plus U*V', in O(n²k) instead of inverting again
+ * (Sherman-Morrison when U and V are vectors, otherwise Woodbury)
+ * 
+ * For example, to change row r of the matrix by d, U is the r-th column of the identity and V is d'
+ * 
+ * @param write A pointer to the inverse of the matrix, which is updated in place
+ * @param u A pointer to U (n by k)
+ * @param v A pointer to V (n by k)
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the sizes are wrong or the updated matrix is singular (in which case the inverse is left unchanged)
+ */
+bool mxInverseUpdate(matrix *write, const matrix *u, const matrix *v);
+
 /**
  * @brief Solves for a particular element within a particular vector using Cramer's rule
  * 
@@ -386,6 +639,49 @@ mxElement_t mxSolveCramer(const matrix *transform, const matrix *result, int vec
  */
 bool mxSolveInverse(matrix *write, const matrix *transform, const matrix *result);
 
+/**
+ * @brief Solves for all vectors of a symmetric positive-definite transformation, using its Cholesky decomposition
+ * 
+ * This takes about half the work of Gauss elimination, and needs no pivoting (only the lower triangle is read)
+ * 
+ * @param write A pointer to where the result will be written (may be the resultant matrix)
+ * @param transform A pointer to the transformation matrix
+ * @param result A pointer to the resultant matrix
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the transformation is not square or positive-definite
+ */
+bool mxSolveCholesky(matrix *write, const matrix *transform, const matrix *result);
+
+/**
+ * @brief Solves for all vectors of a symmetric transformation, using its LDL' decomposition
+ * 
+ * Unlike Cholesky, this needs no square roots, and works for some symmetric matrices that aren't positive-definite
+ * 
+ * @param write A pointer to where the result will be written (may be the resultant matrix)
+ * @param transform A pointer to the transformation matrix
+ * @param result A pointer to the resultant matrix
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the transformation is not square or has a zero pivot
+ */
+bool mxSolveLDL(matrix *write, const matrix *transform, const matrix *result);
+
+/**
+ * @brief Solves for all vectors in the least-squares sense (minimising the length of transform*write-result),
+ * for a transformation with at least as many rows as columns
+ * 
+ * This uses a QR decomposition, which is more accurate than solving the normal equations
+ * 
+ * @param write A pointer to where the result will be written
+ * @param transform A pointer to the transformation matrix
+ * @param result A pointer to the resultant matrix
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the transformation is wider than it is tall, or its columns are dependent
+ */
+bool mxSolveLeastSquares(matrix *write, const matrix *transform, const matrix *result);
+
 /**
  * @brief Turns a matrix into Reduced Row Echelon Form, and edits 1 additional matrix as collateral
  * 
@@ -417,6 +713,1533 @@ void mxReducedEchelon(matrix *write, const matrix *read);
  */
 bool mxSolveGauss(matrix *write, const matrix *transform, const matrix *result);
 
+/*================================*/
+/* FIXED SIZES ================================*/
+
+//The generic functions use these automatically, when the matrices are square and one of these sizes
+
+#if MX_SIZE>=2
+/**
+ * @brief Multiplies two 2x2 matrices (the sizes aren't checked)
+ * 
+ * @param write A pointer to where the result will be written (may be one of the matrices being multiplied)
+ * @param read1 A pointer to the first matrix (transformation)
+ * @param read2 A pointer to the second matrix (vector)
+ */
+void mxMultiply2(matrix *write, const matrix *read1, const matrix *read2);
+
+/**
+ * @brief Returns the determinant of a 2x2 matrix (the size isn't checked)
+ * 
+ * @param read A pointer to the matrix
+ * 
+ * @return The value of the determinant
+ */
+mxElement_t mxDeterminant2(const matrix *read);
+
+/**
+ * @brief Inverts a 2x2 matrix, using the adjoint and the determinant (the size isn't checked)
+ * 
+ * @param write A pointer to where the result will be written (may be the same matrix)
+ * @param read A pointer to the matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the matrix is singular
+ */
+bool mxInverse2(matrix *write, const matrix *read);
+
+/**
+ * @brief Transposes a 2x2 matrix (the size isn't checked)
+ * 
+ * @param write A pointer to where the result will be written (may be the same matrix)
+ * @param read A pointer to the matrix
+ */
+void mxTranspose2(matrix *write, const matrix *read);
+#endif
+
+#if MX_SIZE>=3
+/**
+ * @brief Multiplies two 3x3 matrices (the sizes aren't checked)
+ * 
+ * @param write A pointer to where the result will be written (may be one of the matrices being multiplied)
+ * @param read1 A pointer to the first matrix (transformation)
+ * @param read2 A pointer to the second matrix (vector)
+ */
+void mxMultiply3(matrix *write, const matrix *read1, const matrix *read2);
+
+/**
+ * @brief Returns the determinant of a 3x3 matrix (the size isn't checked)
+ * 
+ * @param read A pointer to the matrix
+ * 
+ * @return The value of the determinant
+ */
+mxElement_t mxDeterminant3(const matrix *read);
+
+/**
+ * @brief Inverts a 3x3 matrix, using the adjoint and the determinant (the size isn't checked)
+ * 
+ * @param write A pointer to where the result will be written (may be the same matrix)
+ * @param read A pointer to the matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the matrix is singular
+ */
+bool mxInverse3(matrix *write, const matrix *read);
+
+/**
+ * @brief Transposes a 3x3 matrix (the size isn't checked)
+ * 
+ * @param write A pointer to where the result will be written (may be the same matrix)
+ * @param read A pointer to the matrix
+ */
+void mxTranspose3(matrix *write, const matrix *read);
+#endif
+
+#if MX_SIZE>=4
+/**
+ * @brief Multiplies two 4x4 matrices (the sizes aren't checked)
+ * 
+ * @param write A pointer to where the result will be written (may be one of the matrices being multiplied)
+ * @param read1 A pointer to the first matrix (transformation)
+ * @param read2 A pointer to the second matrix (vector)
+ */
+void mxMultiply4(matrix *write, const matrix *read1, const matrix *read2);
+
+/**
+ * @brief Returns the determinant of a 4x4 matrix (the size isn't checked)
+ * 
+ * @param read A pointer to the matrix
+ * 
+ * @return The value of the determinant
+ */
+mxElement_t mxDeterminant4(const matrix *read);
+
+/**
+ * @brief Inverts a 4x4 matrix, using the adjoint and the determinant (the size isn't checked)
+ * 
+ * @param write A pointer to where the result will be written (may be the same matrix)
+ * @param read A pointer to the matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the matrix is singular
+ */
+bool mxInverse4(matrix *write, const matrix *read);
+
+/**
+ * @brief Transposes a 4x4 matrix (the size isn't checked)
+ * 
+ * @param write A pointer to where the result will be written (may be the same matrix)
+ * @param read A pointer to the matrix
+ */
+void mxTranspose4(matrix *write, const matrix *read);
+#endif
+
+/*================================*/
+/* DECOMPOSITIONS ================================*/
+
+/**
+ * @brief Decomposes a square matrix into lower and upper triangular matrices, using partial pivoting
+ * 
+ * @param write A pointer to where the decomposition will be written
+ * @param read A pointer to the matrix
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the matrix is not square or is singular
+ */
+bool mxLU(mxLUFactor *write, const matrix *read);
+
+/**
+ * @param read A pointer to the decomposition
+ * 
+ * @return The determinant of the decomposed matrix
+ */
+mxElement_t mxLUDeterminant(const mxLUFactor *read);
+
+/**
+ * @brief Solves for all vectors, using a decomposition of the transformation matrix
+ * 
+ * Each vector takes O(n^2) steps, so this is much faster than solving from the transform again
+ * 
+ * @param write A pointer to where the result will be written (may be the resultant matrix)
+ * @param factor A pointer to the decomposition of the transformation matrix
+ * @param result A pointer to the resultant matrix
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the decomposition is out of date, is of a singular matrix, or is the wrong size
+ */
+bool mxLUSolve(matrix *write, const mxLUFactor *factor, const matrix *result);
+
+/**
+ * @brief Marks a decomposition as out of date (call this when the transformation matrix changes)
+ * 
+ * @param write A pointer to the decomposition
+ */
+void mxLUInvalidate(mxLUFactor *write);
+
+/**
+ * @brief Decomposes the matrix again, only if the decomposition was marked as out of date
+ * 
+ * The decomposition must have been written by mxLU, or marked by mxLUInvalidate, before its first update
+ * 
+ * @param write A pointer to the decomposition
+ * @param read A pointer to the matrix
+ * 
+ * @return 1 (true) if the decomposition is up to date,
+ * otherwise returns 0 (false) if the matrix is not square or is singular
+ */
+bool mxLUUpdate(mxLUFactor *write, const matrix *read);
+
+/**
+ * @brief Solves for all vectors using a decomposition of the transformation matrix, then refines each solution
+ * with residuals found in double precision (and corrections solved with the decomposition)
+ * 
+ * With float elements, this reaches near-double accuracy for well-conditioned matrices, at near-float cost.
+ * Refining stops when the residual is as small as double rounding allows, when the correction stops shrinking, or after MX_REFINE_STEPS steps
+ * 
+ * @param write A pointer to where the result will be written (may be the resultant matrix)
+ * @param factor A pointer to the decomposition of the transformation matrix
+ * @param transform A pointer to the transformation matrix that was decomposed (or one close to it, such as after a small change,
+ * in which case the refinement makes up the difference)
+ * @param result A pointer to the resultant matrix
+ * @param report A pointer to where the solution in double precision, the steps taken and the final residual will be written (may be null)
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the decomposition is out of date, is of a singular matrix, or the sizes are wrong
+ */
+bool mxLUSolveRefined(matrix *write, const mxLUFactor *factor, const matrix *transform, const matrix *result, mxRefineReport *report);
+
+/**
+ * @brief Solves for all vectors with mixed precision: decomposes the transformation matrix in the element type,
+ * then refines each solution with residuals found in double precision (see mxLUSolveRefined)
+ * 
+ * @param write A pointer to where the result will be written (may be the resultant matrix)
+ * @param transform A pointer to the square transformation matrix
+ * @param result A pointer to the resultant matrix
+ * @param report A pointer to where the solution in double precision, the steps taken and the final residual will be written (may be null)
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the transformation is not square or is singular, or the sizes are wrong
+ */
+bool mxSolveRefined(matrix *write, const matrix *transform, const matrix *result, mxRefineReport *report);
+
+/**
+ * @brief Decomposes a symmetric positive-definite matrix into a lower triangular matrix L, where L*L' is the matrix
+ * 
+ * Only the lower triangle is read, and the upper triangle of the result is zero
+ * 
+ * @param write A pointer to where the decomposition will be written (may be the same matrix)
+ * @param read A pointer to the matrix
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the matrix is not square or positive-definite (in which case Write is left unchanged)
+ */
+bool mxCholesky(matrix *write, const matrix *read);
+
+/**
+ * @brief Solves for all vectors, using a Cholesky decomposition of the transformation matrix
+ * 
+ * @param write A pointer to where the result will be written (may be the resultant matrix)
+ * @param factor A pointer to the decomposition (from mxCholesky)
+ * @param result A pointer to the resultant matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxCholeskySolve(matrix *write, const matrix *factor, const matrix *result);
+
+/**
+ * @brief Updates a Cholesky decomposition L of A to the decomposition of A+x*x', in O(n²) instead of decomposing again
+ * 
+ * @param write A pointer to the decomposition (from mxCholesky), which is updated in place
+ * @param vector A pointer to the vector x (n by 1)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the sizes are wrong
+ */
+bool mxCholeskyUpdate(matrix *write, const matrix *vector);
+
+/**
+ * @brief Downdates a Cholesky decomposition L of A to the decomposition of A-x*x', in O(n²) instead of decomposing again
+ * 
+ * @param write A pointer to the decomposition (from mxCholesky), which is updated in place
+ * @param vector A pointer to the vector x (n by 1)
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the sizes are wrong or A-x*x' isn't positive-definite (in which case the decomposition is left unchanged)
+ */
+bool mxCholeskyDowndate(matrix *write, const matrix *vector);
+
+/**
+ * @brief Decomposes a symmetric matrix into L*D*L', where L is unit lower triangular and D is diagonal
+ * 
+ * Only the lower triangle is read. L is written below the diagonal, D on the diagonal, and the upper triangle is zero
+ * 
+ * @param write A pointer to where the decomposition will be written (may be the same matrix)
+ * @param read A pointer to the matrix
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the matrix is not square or has a zero pivot (in which case Write is left unchanged)
+ */
+bool mxLDL(matrix *write, const matrix *read);
+
+/**
+ * @brief Solves for all vectors, using an LDL' decomposition of the transformation matrix
+ * 
+ * @param write A pointer to where the result will be written (may be the resultant matrix)
+ * @param factor A pointer to the decomposition (from mxLDL)
+ * @param result A pointer to the resultant matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxLDLSolve(matrix *write, const matrix *factor, const matrix *result);
+
+/**
+ * @brief Decomposes a matrix into an orthogonal matrix Q and an upper triangular matrix R, using Householder reflections
+ * 
+ * @param write A pointer to where the decomposition will be written
+ * @param read A pointer to the matrix
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the matrix is wider than it is tall
+ */
+bool mxQR(mxQRFactor *write, const matrix *read);
+
+/**
+ * @brief Solves for all vectors in the least-squares sense, using a QR decomposition of the transformation
+ * 
+ * @param write A pointer to where the result will be written (may be the resultant matrix)
+ * @param factor A pointer to the decomposition
+ * @param result A pointer to the resultant matrix
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the result is the wrong size, or the transformation's columns are dependent
+ */
+bool mxQRSolve(matrix *write, const mxQRFactor *factor, const matrix *result);
+
+/**
+ * @brief Finds the eigenvalues and eigenvectors of a symmetric matrix, from largest to smallest,
+ * by reducing it to a tridiagonal matrix and using the implicit QL algorithm
+ * 
+ * @param writeValues An array of 'rows' elements where the eigenvalues will be written
+ * @param writeVectors A pointer to where the eigenvectors will be written as columns (may be null, if only the eigenvalues are wanted)
+ * @param read A pointer to the symmetric matrix
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the matrix is not square, or the algorithm did not converge (in which case the eigenvectors are left unchanged)
+ */
+bool mxEigen(mxElement_t *writeValues, matrix *writeVectors, const matrix *read);
+
+/**
+ * @brief Finds the 'count' largest eigenvalues and their eigenvectors of a symmetric matrix, from largest to smallest.
+ * The eigenvectors are found by inverse iteration, so a few of them cost much less than all of them
+ * 
+ * @param writeValues An array of 'count' elements where the eigenvalues will be written
+ * @param writeVectors A pointer to where the eigenvectors will be written as columns (may be null, if only the eigenvalues are wanted)
+ * @param read A pointer to the symmetric matrix
+ * @param count The number of eigenvalues to find
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the matrix is not square, the count is out of range, or the algorithm did not converge (in which case the eigenvectors are left unchanged)
+ */
+bool mxEigen_top(mxElement_t *writeValues, matrix *writeVectors, const matrix *read, int count);
+
+/**
+ * @brief Decomposes a matrix into U*S*V', where U and V have orthonormal columns and S is diagonal,
+ * using one-sided Jacobi rotations
+ * 
+ * @param writeU A pointer to where U will be written, with the smaller of 'rows' and 'columns' as its columns (may be null)
+ * @param writeValues An array where the singular values (the diagonal of S) will be written, from largest to smallest
+ * @param writeV A pointer to where V will be written, with the same number of columns as U (may be null)
+ * @param read A pointer to the matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the algorithm did not converge
+ */
+bool mxSVD(matrix *writeU, mxElement_t *writeValues, matrix *writeV, const matrix *read);
+
+/**
+ * @brief Writes the pseudo-inverse of a matrix (which may be rank-deficient or not square), using its singular value decomposition.
+ * Singular values below the SVD tolerance (relative to the largest, see MX_SVD_TOLERANCE) count as zero
+ * 
+ * @param write A pointer to where the pseudo-inverse will be written (may be the same matrix)
+ * @param read A pointer to the matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the algorithm did not converge
+ */
+bool mxPseudoInverse(matrix *write, const matrix *read);
+
+/**
+ * @brief Returns the rank of a matrix, counting the singular values above the SVD tolerance (relative to the largest, see MX_SVD_TOLERANCE)
+ * 
+ * @param read A pointer to the matrix
+ * 
+ * @return The rank of the matrix, otherwise returns -1 if the algorithm did not converge
+ */
+int mxRank(const matrix *read);
+
+/**
+ * @brief Writes the exponential of a square matrix, using scaling and squaring with a (6,6) Padé approximant
+ * 
+ * @param write A pointer to where the exponential will be written (may be the same matrix)
+ * @param read A pointer to the matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the matrix is not square or not finite
+ */
+bool mxExp(matrix *write, const matrix *read);
+
+/**
+ * @brief Discretises a continuous state-space model x' = Ax + Bu with a zero-order hold, so x[k+1] = Ad*x[k] + Bd*u[k]
+ * 
+ * Both are found from one exponential, exp([A B; 0 0]*period) = [Ad Bd; 0 I]
+ * 
+ * @param writeA A pointer to where Ad will be written (may be A)
+ * @param writeB A pointer to where Bd will be written (may be B)
+ * @param a A pointer to the square state matrix A
+ * @param b A pointer to the input matrix B, with a row for each state
+ * @param period The sample period
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the sizes are wrong or the matrices are not finite
+ */
+bool mxDiscretise(matrix *writeA, matrix *writeB, const matrix *a, const matrix *b, double period);
+
+/*================================*/
+/* DYNAMIC MATRICES ================================*/
+
+/**
+ * @brief Sets up an arena, which hands out storage from a buffer
+ * 
+ * @param write A pointer to the arena
+ * @param buffer An array of elements
+ * @param size The length of that array
+ */
+void mxArenaInit(mxArena *write, mxElement_t *buffer, int size);
+
+/**
+ * @brief Takes storage from an arena
+ * 
+ * @param write A pointer to the arena
+ * @param count The number of elements needed
+ * 
+ * @return A pointer to the storage, or 0 (a null pointer) if there is not enough space left
+ */
+mxElement_t *mxArenaAlloc(mxArena *write, int count);
+
+/**
+ * @brief Takes storage for indices from an arena (rounded up to whole elements)
+ * 
+ * The buffer must be aligned for unsigned int, which any array of mxElement_t is when mxElement_t is a float or double
+ * 
+ * @param write A pointer to the arena
+ * @param count The number of indices needed
+ * 
+ * @return A pointer to the storage, or 0 (a null pointer) if there is not enough space left
+ */
+unsigned int *mxArenaAllocIndices(mxArena *write, int count);
+
+/**
+ * @brief Returns all the storage that an arena has handed out
+ * 
+ * @param write A pointer to the arena
+ */
+void mxArenaReset(mxArena *write);
+
+/**
+ * @brief Sets up a dynamic matrix over storage, with rows stored one after another
+ * 
+ * @param write A pointer to the dynamic matrix
+ * @param storage An array of at least rows*columns elements
+ * @param rows The number of rows
+ * @param columns The number of columns
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynInit(mxDyn *write, mxElement_t *storage, int rows, int columns);
+
+/**
+ * @brief Sets up a dynamic matrix over storage, with a gap between the starts of consecutive rows
+ * 
+ * @param write A pointer to the dynamic matrix
+ * @param storage An array of at least (rows-1)*stride+columns elements
+ * @param rows The number of rows
+ * @param columns The number of columns
+ * @param stride The number of elements between the starts of consecutive rows
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynInit_stride(mxDyn *write, mxElement_t *storage, int rows, int columns, int stride);
+
+/**
+ * @brief Sets up a dynamic matrix with storage taken from an arena
+ * 
+ * @param write A pointer to the dynamic matrix
+ * @param arena A pointer to the arena
+ * @param rows The number of rows
+ * @param columns The number of columns
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if there is not enough space left
+ */
+bool mxDynAlloc(mxDyn *write, mxArena *arena, int rows, int columns);
+
+/**
+ * @brief Sets up a dynamic matrix that shares the storage of a matrix (no elements are copied)
+ * 
+ * @param write A pointer to the dynamic matrix
+ * @param read A pointer to the matrix
+ */
+void mxDynWrap(mxDyn *write, matrix *read);
+
+/**
+ * @brief Copies a matrix's elements into a dynamic matrix of the same size
+ * 
+ * @param write A pointer to the dynamic matrix
+ * @param read A pointer to the matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynFromMatrix(mxDyn *write, const matrix *read);
+
+/**
+ * @brief Copies a dynamic matrix's elements into a matrix
+ * 
+ * @param write A pointer to the matrix
+ * @param read A pointer to the dynamic matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynToMatrix(matrix *write, const mxDyn *read);
+
+/**
+ * @param read A pointer to the dynamic matrix
+ * @param row The index of the row
+ * @param column The index of the column
+ * 
+ * @return The value of the element,
+ * or 0 if the index is out of bounds
+ */
+mxElement_t mxDynReadElement(const mxDyn *read, int row, int column);
+
+/**
+ * @brief Writes an entry into the given row and column of the given dynamic matrix
+ * 
+ * @param write A pointer to the dynamic matrix
+ * @param row The index of the row
+ * @param column The index of the column
+ * @param entry The value of the entry
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynWriteElement(mxDyn *write, int row, int column, mxElement_t entry);
+
+/**
+ * @brief Copies the second dynamic matrix's elements onto the first (which must be the same size)
+ * 
+ * @param write A pointer to the dynamic matrix that is being copied to
+ * @param read A pointer to the dynamic matrix that is being copied from
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynCopy(mxDyn *write, const mxDyn *read);
+
+/**
+ * @brief Checks if two dynamic matrices are equal
+ * 
+ * @param read1 A pointer to the first dynamic matrix
+ * @param read2 A pointer to the second dynamic matrix
+ * 
+ * @return 1 (true) if the two dynamic matrices are equal, otherwise returns 0 (false)
+ */
+bool mxDynEqual(const mxDyn *read1, const mxDyn *read2);
+
+/**
+ * @brief Sets every element of a dynamic matrix to 0 (the size is kept)
+ * 
+ * @param write A pointer to the dynamic matrix
+ */
+void mxDynZero(mxDyn *write);
+
+/**
+ * @brief Turns a square dynamic matrix into the identity matrix
+ * 
+ * @param write A pointer to the dynamic matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynIdentity(mxDyn *write);
+
+/**
+ * @brief Adds the second dynamic matrix to the first
+ * 
+ * @param write A pointer to where the result will be written (already sized)
+ * @param read1 A pointer to the first dynamic matrix
+ * @param read2 A pointer to the second dynamic matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynAdd(mxDyn *write, const mxDyn *read1, const mxDyn *read2);
+
+/**
+ * @brief Scales/Multiplies the given dynamic matrix by a factor
+ * 
+ * @param write A pointer to where the result will be written (already sized)
+ * @param read A pointer to the dynamic matrix
+ * @param factor The value of the factor/scalar
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynScale(mxDyn *write, const mxDyn *read, double factor);
+
+/**
+ * @brief Multiplies two dynamic matrices
+ * 
+ * They're always multiplied directly, so large matrices are faster with mxDynGemm and an arena (which packs them into cache-sized blocks).
+ * 'write' must not share storage with either of the dynamic matrices being multiplied
+ * 
+ * @param write A pointer to where the result will be written (already sized)
+ * @param read1 A pointer to the first dynamic matrix (transformation)
+ * @param read2 A pointer to the second dynamic matrix (vector)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynMultiply(mxDyn *write, const mxDyn *read1, const mxDyn *read2);
+
+/**
+ * @brief Multiplies two dynamic matrices, and accumulates them into a scaled Write (write = alpha*read1*read2 + beta*write)
+ * 
+ * Large matrices are multiplied in cache-sized blocks, packed into MX_GEMM_PACK elements of the arena
+ * (if the arena is null or doesn't have room, they're multiplied directly instead).
+ * 'write' must not share storage with either of the dynamic matrices being multiplied
+ * 
+ * @param write A pointer to where the result will be written (already sized)
+ * @param alpha The scalar of the product
+ * @param read1 A pointer to the first dynamic matrix (transformation)
+ * @param read2 A pointer to the second dynamic matrix (vector)
+ * @param beta The scalar of Write's existing elements (if 0, they're ignored)
+ * @param work A pointer to the arena to take the packed blocks from (may be null)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynGemm(mxDyn *write, double alpha, const mxDyn *read1, const mxDyn *read2, double beta, mxArena *work);
+
+/**
+ * @brief Transposes the given dynamic matrix.
+ * The elements are split in half recursively, so the pieces fit in cache whatever its size
+ * 
+ * 'write' must not share storage with the dynamic matrix being transposed
+ * 
+ * @param write A pointer to where the result will be written (already sized)
+ * @param read A pointer to the dynamic matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynTranspose(mxDyn *write, const mxDyn *read);
+
+/**
+ * @brief Transposes a square dynamic matrix in place (without a temporary matrix)
+ * 
+ * @param write A pointer to the dynamic matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the matrix is not square
+ */
+bool mxDynTranspose_inplace(mxDyn *write);
+
+/**
+ * @brief Turns a dynamic matrix into Reduced Row Echelon Form, and edits 1 additional dynamic matrix as collateral
+ * 
+ * @param writeReduce A pointer to where the result will be written (already sized)
+ * @param writeCollateral A pointer to where the collateral result will be written (already sized)
+ * @param readReduce A pointer to the dynamic matrix
+ * @param readCollateral A pointer to the collateral dynamic matrix
+ * @param work A pointer to an arena with space for 'rows' indices (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynReducedEchelon_coll(mxDyn *writeReduce, mxDyn *writeCollateral, const mxDyn *readReduce, const mxDyn *readCollateral, mxArena *work);
+
+/**
+ * @brief Turns a dynamic matrix into Reduced Row Echelon Form
+ * 
+ * @param write A pointer to where the result will be written (already sized)
+ * @param read A pointer to the dynamic matrix
+ * @param work A pointer to an arena with space for 'rows' indices (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynReducedEchelon(mxDyn *write, const mxDyn *read, mxArena *work);
+
+/**
+ * @brief Solves for all vectors where possible, using Guass reduction
+ * 
+ * All vectors that could not be solved for are written as zero-vectors
+ * 
+ * @param write A pointer to where the result will be written (already sized)
+ * @param transform A pointer to the transformation dynamic matrix
+ * @param result A pointer to the resultant dynamic matrix
+ * @param work A pointer to an arena with space for a copy of the transformation and the result, and 'rows' indices
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynSolveGauss(mxDyn *write, const mxDyn *transform, const mxDyn *result, mxArena *work);
+
+/**
+ * @brief Decomposes a dynamic matrix into an orthogonal matrix Q and an upper triangular matrix R, using Householder reflections
+ * 
+ * Matrices wider than MX_QR_BLOCK are done in blocks of columns, so most of the work is matrix multiplication
+ * 
+ * @param write A pointer to where the decomposition will be written (already sized, and may be the same matrix):
+ * R on and above the diagonal, and the reflectors below the diagonal (without their leading 1s)
+ * @param tau An array of 'columns' elements, where the scale of each reflector I-tau*v*v' will be written
+ * @param read A pointer to the dynamic matrix
+ * @param work A pointer to an arena with space for MX_QR_BLOCK*(2*rows+MX_QR_BLOCK+2*columns) elements (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the matrix is wider than it is tall, or there is not enough workspace
+ */
+bool mxDynQR(mxDyn *write, mxElement_t *tau, const mxDyn *read, mxArena *work);
+
+/**
+ * @brief Solves for all vectors in the least-squares sense, using a QR decomposition of the transformation
+ * 
+ * @param write A pointer to where the result will be written (already sized)
+ * @param factor A pointer to the decomposition (from mxDynQR)
+ * @param tau An array of the scale of each reflector (from mxDynQR)
+ * @param result A pointer to the resultant dynamic matrix
+ * @param work A pointer to an arena with space for a copy of the result (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the sizes are wrong, the transformation's columns are dependent, or there is not enough workspace
+ */
+bool mxDynQRSolve(mxDyn *write, const mxDyn *factor, const mxElement_t *tau, const mxDyn *result, mxArena *work);
+
+/**
+ * @brief Solves for all vectors in the least-squares sense (minimising the length of transform*write-result),
+ * for a transformation with at least as many rows as columns
+ * 
+ * @param write A pointer to where the result will be written (already sized)
+ * @param transform A pointer to the transformation dynamic matrix
+ * @param result A pointer to the resultant dynamic matrix
+ * @param work A pointer to an arena with space for the decomposition and its workspace (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynSolveLeastSquares(mxDyn *write, const mxDyn *transform, const mxDyn *result, mxArena *work);
+
+/**
+ * @brief Finds the eigenvalues and eigenvectors of a symmetric dynamic matrix, from largest to smallest,
+ * by reducing it to a tridiagonal matrix and using the implicit QL algorithm
+ * 
+ * @param writeValues An array of 'rows' elements where the eigenvalues will be written
+ * @param writeVectors A pointer to where the eigenvectors will be written as columns (already sized, or null if only the eigenvalues are wanted)
+ * @param read A pointer to the symmetric dynamic matrix
+ * @param work A pointer to an arena with space for rows*(rows+10) elements (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynEigen(mxElement_t *writeValues, mxDyn *writeVectors, const mxDyn *read, mxArena *work);
+
+/**
+ * @brief Finds the 'count' largest eigenvalues and their eigenvectors of a symmetric dynamic matrix, from largest to smallest.
+ * The eigenvectors are found by inverse iteration, so a few of them cost much less than all of them
+ * 
+ * @param writeValues An array of 'count' elements where the eigenvalues will be written
+ * @param writeVectors A pointer to where the eigenvectors will be written as columns (already sized 'rows' by 'count', or null if only the eigenvalues are wanted)
+ * @param read A pointer to the symmetric dynamic matrix
+ * @param count The number of eigenvalues to find
+ * @param work A pointer to an arena with space for rows*(rows+10) elements (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynEigen_top(mxElement_t *writeValues, mxDyn *writeVectors, const mxDyn *read, int count, mxArena *work);
+
+/**
+ * @brief Decomposes a dynamic matrix into U*S*V', where U and V have orthonormal columns and S is diagonal,
+ * using one-sided Jacobi rotations
+ * 
+ * @param writeU A pointer to where U will be written (already sized 'rows' by the smaller of 'rows' and 'columns', or null)
+ * @param writeValues An array where the singular values (the diagonal of S) will be written, from largest to smallest
+ * @param writeV A pointer to where V will be written (already sized 'columns' by the smaller of 'rows' and 'columns', or null)
+ * @param read A pointer to the dynamic matrix
+ * @param work A pointer to an arena with space for a copy of the matrix and V (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynSVD(mxDyn *writeU, mxElement_t *writeValues, mxDyn *writeV, const mxDyn *read, mxArena *work);
+
+/**
+ * @brief Finds the 'count' largest singular values and their vectors of a dynamic matrix, using a randomized range finder:
+ * the matrix is multiplied by count+MX_SVD_OVERSAMPLE random vectors (with MX_SVD_POWER power iterations),
+ * and only the small matrix projected onto their range is decomposed
+ * 
+ * @param writeU A pointer to where the first 'count' columns of U will be written (already sized 'rows' by 'count', or null)
+ * @param writeValues An array of 'count' elements where the singular values will be written, from largest to smallest
+ * @param writeV A pointer to where the first 'count' columns of V will be written (already sized 'columns' by 'count', or null)
+ * @param read A pointer to the dynamic matrix
+ * @param count The number of singular values to find
+ * @param work A pointer to an arena with space for rows*columns+l*(2*rows+columns+l+2) elements,
+ * where l is count+MX_SVD_OVERSAMPLE (at most the smaller of 'rows' and 'columns'), given back before returning
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynSVD_top(mxDyn *writeU, mxElement_t *writeValues, mxDyn *writeV, const mxDyn *read, int count, mxArena *work);
+
+/**
+ * @brief Writes the pseudo-inverse of a dynamic matrix (which may be rank-deficient or not square), using its singular value decomposition.
+ * Singular values below the SVD tolerance (relative to the largest, see MX_SVD_TOLERANCE) count as zero
+ * 
+ * @param write A pointer to where the pseudo-inverse will be written (already sized 'columns' by 'rows', and not sharing storage with Read)
+ * @param read A pointer to the dynamic matrix
+ * @param work A pointer to an arena with space for the decomposition and its workspace (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynPseudoInverse(mxDyn *write, const mxDyn *read, mxArena *work);
+
+/**
+ * @brief Returns the rank of a dynamic matrix, counting the singular values above the SVD tolerance (relative to the largest, see MX_SVD_TOLERANCE)
+ * 
+ * @param read A pointer to the dynamic matrix
+ * @param work A pointer to an arena with space for the decomposition and its workspace (given back before returning)
+ * 
+ * @return The rank of the matrix, otherwise returns -1 if the process was unsuccessful
+ */
+int mxDynRank(const mxDyn *read, mxArena *work);
+
+/**
+ * @brief Writes the exponential of a square dynamic matrix, using scaling and squaring with a (6,6) Padé approximant
+ * 
+ * @param write A pointer to where the exponential will be written (already sized, and may be the same matrix)
+ * @param read A pointer to the dynamic matrix
+ * @param work A pointer to an arena with space for 6*size*size+size elements (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynExp(mxDyn *write, const mxDyn *read, mxArena *work);
+
+/**
+ * @brief Discretises a continuous state-space model x' = Ax + Bu with a zero-order hold, so x[k+1] = Ad*x[k] + Bd*u[k]
+ * 
+ * @param writeA A pointer to where Ad will be written (already sized, and may be A)
+ * @param writeB A pointer to where Bd will be written (already sized, and may be B)
+ * @param a A pointer to the square state dynamic matrix A
+ * @param b A pointer to the input dynamic matrix B, with a row for each state
+ * @param period The sample period
+ * @param work A pointer to an arena with space for 8*size*size+size elements, where size is the number of states plus inputs (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxDynDiscretise(mxDyn *writeA, mxDyn *writeB, const mxDyn *a, const mxDyn *b, double period, mxArena *work);
+
+/**
+ * @brief Updates the inverse of a dynamic matrix to the inverse of the matrix plus U*V', in O(n²k) instead of inverting again
+ * 
+ * @param write A pointer to the inverse of the matrix, which is updated in place
+ * @param u A pointer to U (n by k)
+ * @param v A pointer to V (n by k)
+ * @param work A pointer to an arena with space for 2*n*k+k*k+k elements (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the sizes are wrong, or the updated matrix is singular (in which case the inverse is left unchanged)
+ */
+bool mxDynInverseUpdate(mxDyn *write, const mxDyn *u, const mxDyn *v, mxArena *work);
+
+/*================================*/
+/* VIEWS ================================*/
+
+/**
+ * @brief Sets up a view of a whole matrix
+ * 
+ * @param write A pointer to the view
+ * @param read A pointer to the matrix (which must outlive the view)
+ */
+void mxViewMatrix(mxView *write, matrix *read);
+
+/**
+ * @brief Sets up a view of a whole dynamic matrix
+ * 
+ * @param write A pointer to the view
+ * @param read A pointer to the dynamic matrix
+ */
+void mxViewDyn(mxView *write, mxDyn *read);
+
+/**
+ * @brief Sets up a view of a block of another view
+ * 
+ * @param write A pointer to the view (may be the same view)
+ * @param read A pointer to the other view
+ * @param row The index of the block's first row
+ * @param column The index of the block's first column
+ * @param rows The number of rows in the block
+ * @param columns The number of columns in the block
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the block is outside the view
+ */
+bool mxViewBlock(mxView *write, const mxView *read, int row, int column, int rows, int columns);
+
+/**
+ * @brief Sets up a view of a row of another view
+ * 
+ * @param write A pointer to the view (may be the same view)
+ * @param read A pointer to the other view
+ * @param index The index of the row
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the row is outside the view
+ */
+bool mxViewRow(mxView *write, const mxView *read, int index);
+
+/**
+ * @brief Sets up a view of a column of another view
+ * 
+ * @param write A pointer to the view (may be the same view)
+ * @param read A pointer to the other view
+ * @param index The index of the column
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the column is outside the view
+ */
+bool mxViewColumn(mxView *write, const mxView *read, int index);
+
+/**
+ * @brief Sets up a view of another view with a row and a column left out (a minor), without copying or shifting any elements
+ * 
+ * @param write A pointer to the view (may be the same view)
+ * @param read A pointer to the other view, which must not already leave out a row or column
+ * @param row The index of the row to leave out
+ * @param column The index of the column to leave out
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the row or column is outside the view, or the view already leaves one out
+ */
+bool mxViewMinor(mxView *write, const mxView *read, int row, int column);
+
+/**
+ * @brief Sets up a view of the transpose of another view (by swapping its strides)
+ * 
+ * @param write A pointer to the view (may be the same view)
+ * @param read A pointer to the other view
+ */
+void mxViewTranspose(mxView *write, const mxView *read);
+
+/**
+ * @brief Returns an element from a view
+ * 
+ * @param read A pointer to the view
+ * @param row The index of the row
+ * @param column The index of the column
+ * 
+ * @return The element, otherwise returns 0 if the element is outside the view
+ */
+mxElement_t mxViewReadElement(const mxView *read, int row, int column);
+
+/**
+ * @brief Writes an element of a view (which writes it into the viewed matrix)
+ * 
+ * @param write A pointer to the view
+ * @param row The index of the row
+ * @param column The index of the column
+ * @param entry The value of the element
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the element is outside the view
+ */
+bool mxViewWriteElement(mxView *write, int row, int column, mxElement_t entry);
+
+/**
+ * @brief Adds two views together, writing into a third
+ * 
+ * @param write A pointer to the view where the result will be written (may be one of the views)
+ * @param read1 A pointer to the first view
+ * @param read2 A pointer to the second view
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the sizes are different
+ */
+bool mxViewAdd(mxView *write, const mxView *read1, const mxView *read2);
+
+/**
+ * @brief Multiplies a view by a scalar, writing into another view
+ * 
+ * @param write A pointer to the view where the result will be written (may be the same view)
+ * @param read A pointer to the view
+ * @param factor The scalar
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the sizes are different
+ */
+bool mxViewScale(mxView *write, const mxView *read, double factor);
+
+/**
+ * @brief Writes alpha*read1*read2+beta*write, for views (such as updating one block of a matrix with the product of two others)
+ * 
+ * They're always multiplied directly, since there's no workspace to pack them into (large products are faster with mxDynGemm)
+ * 
+ * @param write A pointer to the view where the result will be written (not overlapping the views being multiplied)
+ * @param alpha The scalar of the product
+ * @param read1 A pointer to the first view
+ * @param read2 A pointer to the second view
+ * @param beta The scalar of Write's current elements (if 0, they don't need to be initialised)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the sizes are wrong, or Write starts at the same element as one of the views
+ */
+bool mxViewGemm(mxView *write, double alpha, const mxView *read1, const mxView *read2, double beta);
+
+/**
+ * @brief Multiplies two views together, writing into a third
+ * 
+ * @param write A pointer to the view where the result will be written (not overlapping the views being multiplied)
+ * @param read1 A pointer to the first view
+ * @param read2 A pointer to the second view
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the sizes are wrong, or Write starts at the same element as one of the views
+ */
+bool mxViewMultiply(mxView *write, const mxView *read1, const mxView *read2);
+
+/**
+ * @brief Returns the determinant of a square view (with MX_EXACT, by cofactor expansion without copying any minors)
+ * 
+ * @param read A pointer to the view, with at most MX_SIZE rows
+ * 
+ * @return The determinant, otherwise returns 0 if the view is not square or too big
+ */
+mxElement_t mxViewDeterminant(const mxView *read);
+
+/**
+ * @brief Solves for all vectors, using views of the transformation and the resulting vectors
+ * 
+ * @param write A pointer to the view where the solution will be written
+ * @param transform A pointer to the view of the transformation
+ * @param result A pointer to the view of the resulting vectors
+ * @param work A pointer to an arena with space for copies of the views and the solution (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxViewSolve(mxView *write, const mxView *transform, const mxView *result, mxArena *work);
+
+/*================================*/
+/* BATCHES ================================*/
+
+/**
+ * @brief Multiplies each pair of matrices from two arrays (write[k] = read1[k]*read2[k])
+ * 
+ * @param write An array of matrices where the results will be written
+ * @param read1 An array of the first matrices (transformations)
+ * @param read2 An array of the second matrices (vectors)
+ * @param count The number of matrices in each array
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if any of the pairs can't be multiplied (then nothing is written)
+ */
+bool mxMultiplyBatch(matrix *write, const matrix *read1, const matrix *read2, int count);
+
+/**
+ * @brief Inverts each matrix from an array
+ * 
+ * @param write An array of matrices where the results will be written
+ * @param read An array of the matrices
+ * @param count The number of matrices in each array
+ * 
+ * @return 1 (true) if every matrix was inverted, otherwise returns 0 (false)
+ */
+bool mxInverseBatch(matrix *write, const matrix *read, int count);
+
+/**
+ * @brief Gets the determinant of each matrix from an array
+ * 
+ * @param write An array where the determinants will be written
+ * @param read An array of the matrices
+ * @param count The number of matrices in each array
+ */
+void mxDeterminantBatch(mxElement_t *write, const matrix *read, int count);
+
+/**
+ * @brief Sets up a batch of same-sized matrices over storage
+ * 
+ * @param write A pointer to the batch
+ * @param storage An array of at least rows*columns*count elements
+ * @param rows The number of rows of each matrix
+ * @param columns The number of columns of each matrix
+ * @param count The number of matrices
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxBatchInit(mxBatch *write, mxElement_t *storage, int rows, int columns, int count);
+
+/**
+ * @brief Copies an array of matrices into a batch
+ * 
+ * @param write A pointer to the batch
+ * @param read An array of as many matrices as the batch holds
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxBatchPack(mxBatch *write, const matrix *read);
+
+/**
+ * @brief Copies a batch into an array of matrices
+ * 
+ * @param write An array of as many matrices as the batch holds
+ * @param read A pointer to the batch
+ */
+void mxBatchUnpack(matrix *write, const mxBatch *read);
+
+/**
+ * @brief Multiplies each pair of matrices from two batches
+ * 
+ * 'write' must not share storage with either of the batches being multiplied
+ * 
+ * @param write A pointer to where the results will be written (already sized)
+ * @param read1 A pointer to the batch of first matrices (transformations)
+ * @param read2 A pointer to the batch of second matrices (vectors)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxBatchMultiply(mxBatch *write, const mxBatch *read1, const mxBatch *read2);
+
+/**
+ * @brief Gets the determinant of each matrix from a batch
+ * 
+ * @param write An array where the determinants will be written
+ * @param read A pointer to the batch
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxBatchDeterminant(mxElement_t *write, const mxBatch *read);
+
+/**
+ * @brief Inverts each matrix from a batch
+ * 
+ * @param write A pointer to where the results will be written (already sized, and may be the same batch)
+ * @param read A pointer to the batch
+ * 
+ * @return 1 (true) if every matrix was inverted, otherwise returns 0 (false)
+ */
+bool mxBatchInverse(mxBatch *write, const mxBatch *read);
+
+/*================================*/
+/* SPARSE MATRICES ================================*/
+
+/**
+ * @brief Sets up an empty (zero) sparse matrix over storage
+ * 
+ * @param write A pointer to the sparse matrix
+ * @param rowStart An array of at least rows+1 indices
+ * @param columnIndices An array of at least 'capacity' indices
+ * @param elements An array of at least 'capacity' elements
+ * @param capacity The number of elements that can be stored
+ * @param rows The number of rows
+ * @param columns The number of columns
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxSparseInit(mxSparse *write, unsigned int *rowStart, unsigned int *columnIndices, mxElement_t *elements, int capacity, int rows, int columns);
+
+/**
+ * @brief Sets up an empty (zero) sparse matrix with storage taken from an arena
+ * 
+ * @param write A pointer to the sparse matrix
+ * @param arena A pointer to the arena
+ * @param rows The number of rows
+ * @param columns The number of columns
+ * @param capacity The number of elements that can be stored
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if there is not enough space left
+ */
+bool mxSparseAlloc(mxSparse *write, mxArena *arena, int rows, int columns, int capacity);
+
+/**
+ * @brief Fills a sparse matrix from (row, column, value) triplets, in any order
+ * 
+ * Triplets in the same position are added together
+ * 
+ * @param write A pointer to the sparse matrix (already sized)
+ * @param rowIndices An array of the row of each triplet
+ * @param columnIndices An array of the column of each triplet
+ * @param values An array of the value of each triplet
+ * @param count The number of triplets
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if there are more triplets than storage, or a triplet is out of bounds
+ */
+bool mxSparseFromTriplets(mxSparse *write, const unsigned int *rowIndices, const unsigned int *columnIndices, const mxElement_t *values, int count);
+
+/**
+ * @brief Fills a sparse matrix with the non-zero elements of a matrix of the same size
+ * 
+ * @param write A pointer to the sparse matrix
+ * @param read A pointer to the matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxSparseFromMatrix(mxSparse *write, const matrix *read);
+
+/**
+ * @brief Fills a sparse matrix with the non-zero elements of a dynamic matrix of the same size
+ * 
+ * @param write A pointer to the sparse matrix
+ * @param read A pointer to the dynamic matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxSparseFromDyn(mxSparse *write, const mxDyn *read);
+
+/**
+ * @brief Copies a sparse matrix into a matrix
+ * 
+ * @param write A pointer to the matrix
+ * @param read A pointer to the sparse matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the sparse matrix is too large
+ */
+bool mxSparseToMatrix(matrix *write, const mxSparse *read);
+
+/**
+ * @brief Copies a sparse matrix into a dynamic matrix of the same size
+ * 
+ * @param write A pointer to the dynamic matrix
+ * @param read A pointer to the sparse matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxSparseToDyn(mxDyn *write, const mxSparse *read);
+
+/**
+ * @brief Transposes a sparse matrix
+ * 
+ * The transpose's rows are the original's columns, so this also gives the compressed sparse column form of the original
+ * 
+ * @param write A pointer to where the result will be written (already sized, and not sharing storage with Read)
+ * @param read A pointer to the sparse matrix
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxSparseTranspose(mxSparse *write, const mxSparse *read);
+
+/**
+ * @brief Multiplies a sparse matrix by a vector
+ * 
+ * @param write An array of 'rows' elements where the result will be written (not the vector)
+ * @param read A pointer to the sparse matrix
+ * @param vector An array of 'columns' elements
+ */
+void mxSparseMultiplyVector(mxElement_t *write, const mxSparse *read, const mxElement_t *vector);
+
+/**
+ * @brief Multiplies a sparse matrix by a dynamic matrix
+ * 
+ * 'write' must not share storage with the dynamic matrix being multiplied
+ * 
+ * @param write A pointer to where the result will be written (already sized)
+ * @param read1 A pointer to the sparse matrix (transformation)
+ * @param read2 A pointer to the dynamic matrix (vectors)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxSparseMultiplyDyn(mxDyn *write, const mxSparse *read1, const mxDyn *read2);
+
+/**
+ * @brief Orders the rows (and columns) of a symmetric sparse matrix to keep them close to the diagonal,
+ * using reverse Cuthill-McKee
+ * 
+ * @param write An array of 'rows' indices, where the row of the original matrix at each position will be written
+ * @param read A pointer to the sparse matrix (with both triangles stored)
+ * @param work A pointer to an arena with space for 'rows' indices (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the matrix is not square or there is not enough workspace
+ */
+bool mxSparseOrderRCM(unsigned int *write, const mxSparse *read, mxArena *work);
+
+/**
+ * @brief Decomposes a symmetric positive-definite sparse matrix, into a reordering and a lower triangular matrix (P*A*P' = L*L')
+ * 
+ * The rows are reordered with mxSparseOrderRCM to reduce the fill-in, then the storage for L is worked out exactly
+ * 
+ * @param write A pointer to where the decomposition will be written
+ * @param read A pointer to the sparse matrix (with both triangles stored)
+ * @param storage A pointer to an arena, which the decomposition's arrays are taken from (and stay in use).
+ * The workspace is also taken from it, and given back before returning
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the matrix is not square or positive-definite, or there is not enough space left
+ */
+bool mxSparseCholesky(mxSparseFactor *write, const mxSparse *read, mxArena *storage);
+
+/**
+ * @brief Decomposes a sparse matrix again, reusing the reordering and storage of an existing decomposition
+ * 
+ * The matrix must have the same pattern of non-zero elements as the one the decomposition was made from
+ * 
+ * @param write A pointer to the decomposition (written by mxSparseCholesky)
+ * @param read A pointer to the sparse matrix (with both triangles stored)
+ * @param work A pointer to an arena with space for the workspace (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the matrix is not positive-definite or has a different pattern
+ */
+bool mxSparseCholeskyRefactor(mxSparseFactor *write, const mxSparse *read, mxArena *work);
+
+/**
+ * @brief Solves for a vector, using a sparse decomposition of the transformation matrix
+ * 
+ * @param write An array where the solution will be written (may be the resulting vector)
+ * @param factor A pointer to the decomposition
+ * @param result An array of the resulting vector
+ * @param work A pointer to an arena with space for 'size' elements (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxSparseCholeskySolve(mxElement_t *write, const mxSparseFactor *factor, const mxElement_t *result, mxArena *work);
+
+/*================================*/
+/* BANDED MATRICES ================================*/
+
+/**
+ * @brief Sets up a zero banded matrix over storage
+ * 
+ * @param write A pointer to the banded matrix
+ * @param storage An array of at least size*(2*lower+upper+1) elements
+ * @param size The number of rows and columns
+ * @param lower The number of diagonals below the main diagonal
+ * @param upper The number of diagonals above the main diagonal
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false)
+ */
+bool mxBandInit(mxBand *write, mxElement_t *storage, int size, int lower, int upper);
+
+/**
+ * @brief Sets up a zero banded matrix with storage taken from an arena
+ * 
+ * @param write A pointer to the banded matrix
+ * @param arena A pointer to the arena
+ * @param size The number of rows and columns
+ * @param lower The number of diagonals below the main diagonal
+ * @param upper The number of diagonals above the main diagonal
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if there is not enough space
+ */
+bool mxBandAlloc(mxBand *write, mxArena *arena, int size, int lower, int upper);
+
+/**
+ * @brief Returns an element from a banded matrix
+ * 
+ * @param read A pointer to the banded matrix
+ * @param row The index of the row
+ * @param column The index of the column
+ * 
+ * @return The element, or zero if it is outside the band or the matrix
+ */
+mxElement_t mxBandReadElement(const mxBand *read, int row, int column);
+
+/**
+ * @brief Writes an element of a banded matrix
+ * 
+ * @param write A pointer to the banded matrix
+ * @param row The index of the row
+ * @param column The index of the column
+ * @param entry The value of the element
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the element is outside the band or the matrix
+ */
+bool mxBandWriteElement(mxBand *write, int row, int column, mxElement_t entry);
+
+/**
+ * @brief Multiplies a banded matrix by a vector
+ * 
+ * @param write An array of 'size' elements where the result will be written (not the same as the vector)
+ * @param read A pointer to the banded matrix
+ * @param vector An array of 'size' elements
+ */
+void mxBandMultiplyVector(mxElement_t *write, const mxBand *read, const mxElement_t *vector);
+
+/**
+ * @brief Decomposes a banded matrix into L*U in place, using partial pivoting, in O(size*lower*(lower+upper)) time.
+ * U takes up to lower+upper diagonals above the main diagonal, and the multipliers of L are left below it
+ * 
+ * @param write A pointer to the banded matrix, which is replaced by its decomposition
+ * @param pivots An array of 'size' indices, where the row swapped in at each step will be written
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the matrix is singular
+ */
+bool mxBandLU(mxBand *write, unsigned int *pivots);
+
+/**
+ * @brief Solves for a vector, using a banded LU decomposition of the transformation matrix
+ * 
+ * @param write An array of 'size' elements where the solution will be written (may be the resulting vector)
+ * @param factor A pointer to the decomposition (from mxBandLU)
+ * @param pivots An array of the row swaps (from mxBandLU)
+ * @param result An array of the resulting vector
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if the matrix is singular
+ */
+bool mxBandLUSolve(mxElement_t *write, const mxBand *factor, const unsigned int *pivots, const mxElement_t *result);
+
+/**
+ * @brief Solves for a vector with a tridiagonal transformation in O(size) time, using the Thomas algorithm.
+ * There is no pivoting, so it suits diagonally dominant or positive-definite matrices (otherwise use mxBandLU)
+ * 
+ * @param write An array of 'size' elements where the solution will be written (may be the resulting vector)
+ * @param lower An array of the size-1 elements below the main diagonal ([i] is in row i+1)
+ * @param diagonal An array of the 'size' elements on the main diagonal
+ * @param upper An array of the size-1 elements above the main diagonal ([i] is in row i)
+ * @param result An array of the resulting vector
+ * @param size The number of rows and columns
+ * @param work A pointer to an arena with space for 'size' elements (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if there is a zero pivot or not enough workspace
+ */
+bool mxSolveTridiagonal(mxElement_t *write, const mxElement_t *lower, const mxElement_t *diagonal, const mxElement_t *upper, const mxElement_t *result, int size, mxArena *work);
+
+/**
+ * @brief Solves for a vector in each of many same-sized tridiagonal systems at once, using the Thomas algorithm.
+ * Entry [i] of system k is at [i*count+k] in every array, so each step is done for all of the systems together
+ * 
+ * @param write An array of size*count elements where the solutions will be written (may be the resulting vectors)
+ * @param lower An array of (size-1)*count elements below the main diagonals
+ * @param diagonal An array of size*count elements on the main diagonals
+ * @param upper An array of (size-1)*count elements above the main diagonals
+ * @param result An array of the resulting vectors
+ * @param size The number of rows and columns of each system
+ * @param count The number of systems
+ * @param work A pointer to an arena with space for size*count elements (given back before returning)
+ * 
+ * @return 1 (true) if the process was successful, otherwise returns 0 (false) if any system has a zero pivot or there is not enough workspace
+ */
+bool mxSolveTridiagonalBatch(mxElement_t *write, const mxElement_t *lower, const mxElement_t *diagonal, const mxElement_t *upper, const mxElement_t *result, int size, int count, mxArena *work);
+
+/*================================*/
+/* ITERATIVE SOLVERS ================================*/
+
+/**
+ * @brief Fills in settings for the iterative solvers with the defaults:
+ * a tolerance of 1e-10, 1000 iterations, restarting GMRES every 30, and no preconditioner
+ * 
+ * @param write A pointer to the settings
+ */
+void mxKrylovDefaults(mxKrylovSettings *write);
+
+/**
+ * @brief Multiplies a matrix by a vector, for the iterative solvers
+ * 
+ * @param write An array where the result will be written
+ * @param vector An array of 'columns' elements
+ * @param context A pointer to the matrix
+ */
+void mxOperatorMatrix(mxElement_t *write, const mxElement_t *vector, void *context);
+
+/**
+ * @brief Multiplies a dynamic matrix by a vector, for the iterative solvers
+ * 
+ * @param write An array where the result will be written
+ * @param vector An array of 'columns' elements
+ * @param context A pointer to the dynamic matrix
+ */
+void mxOperatorDyn(mxElement_t *write, const mxElement_t *vector, void *context);
+
+/**
+ * @brief Multiplies a sparse matrix by a vector, for the iterative solvers
+ * 
+ * @param write An array where the result will be written
+ * @param vector An array of 'columns' elements
+ * @param context A pointer to the sparse matrix
+ */
+void mxOperatorSparse(mxElement_t *write, const mxElement_t *vector, void *context);
+
+/**
+ * @brief Sets up a Jacobi preconditioner (dividing by the diagonal) for a sparse matrix
+ * 
+ * @param write A pointer to the preconditioner
+ * @param read A pointer to the square sparse matrix
+ * @param arena A pointer to the arena, where 'rows' elements will be taken
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the matrix is not square, has a zero on its diagonal, or there is not enough space
+ */
+bool mxJacobiInit(mxJacobi *write, const mxSparse *read, mxArena *arena);
+
+/**
+ * @brief Applies a Jacobi preconditioner to a vector (use it as the preconditioner in mxKrylovSettings)
+ * 
+ * @param write An array where the result will be written (may be the vector)
+ * @param vector An array of 'size' elements
+ * @param context A pointer to the preconditioner
+ */
+void mxJacobiApply(mxElement_t *write, const mxElement_t *vector, void *context);
+
+/**
+ * @brief Sets up an incomplete LU preconditioner for a sparse matrix, which keeps the same pattern of elements (ILU(0))
+ * 
+ * @param write A pointer to the preconditioner
+ * @param read A pointer to the square sparse matrix, with every diagonal element stored
+ * @param arena A pointer to the arena, where a copy of the matrix and 2*rows indices will be taken
+ * 
+ * @return 1 (true) if the process was successful,
+ * otherwise returns 0 (false) if the matrix is not square, a diagonal element is missing, there is a zero pivot, or there is not enough space
+ */
+bool mxILUInit(mxILU *write, const mxSparse *read, mxArena *arena);
+
+/**
+ * @brief Applies an incomplete LU preconditioner to a vector (use it as the preconditioner in mxKrylovSettings)
+ * 
+ * @param write An array where the result will be written (may be the vector)
+ * @param vector An array of 'size' elements
+ * @param context A pointer to the preconditioner
+ */
+void mxILUApply(mxElement_t *write, const mxElement_t *vector, void *context);
+
+/**
+ * @brief Solves for a vector with a symmetric positive-definite operator, using the (preconditioned) conjugate gradient method
+ * 
+ * @param write An array of 'size' elements, holding the starting guess (such as zeros), where the solution will be written
+ * @param transform The function that multiplies the operator by a vector
+ * @param context A pointer that is passed to the function (such as a pointer to the matrix)
+ * @param result An array of the resulting vector
+ * @param size The number of rows and columns of the operator
+ * @param settings A pointer to the tolerance, iteration limit and preconditioner (the preconditioner must be symmetric positive-definite)
+ * @param report A pointer to where the iterations and final residual will be written (may be null)
+ * @param work A pointer to an arena with space for 4*size elements (given back before returning)
+ * 
+ * @return 1 (true) if the solver converged, otherwise returns 0 (false)
+ */
+bool mxSolveCG(mxElement_t *write, mxOperator transform, void *context, const mxElement_t *result, int size, const mxKrylovSettings *settings, mxKrylovReport *report, mxArena *work);
+
+/**
+ * @brief Solves for a vector with any square operator, using the (right-preconditioned) BiCGSTAB method
+ * 
+ * @param write An array of 'size' elements, holding the starting guess (such as zeros), where the solution will be written
+ * @param transform The function that multiplies the operator by a vector
+ * @param context A pointer that is passed to the function (such as a pointer to the matrix)
+ * @param result An array of the resulting vector
+ * @param size The number of rows and columns of the operator
+ * @param settings A pointer to the tolerance, iteration limit and preconditioner
+ * @param report A pointer to where the iterations and final residual will be written (may be null)
+ * @param work A pointer to an arena with space for 7*size elements (given back before returning)
+ * 
+ * @return 1 (true) if the solver converged, otherwise returns 0 (false)
+ */
+bool mxSolveBiCGSTAB(mxElement_t *write, mxOperator transform, void *context, const mxElement_t *result, int size, const mxKrylovSettings *settings, mxKrylovReport *report, mxArena *work);
+
+/**
+ * @brief Solves for a vector with any square operator, using the restarted (right-preconditioned) GMRES method
+ * 
+ * @param write An array of 'size' elements, holding the starting guess (such as zeros), where the solution will be written
+ * @param transform The function that multiplies the operator by a vector
+ * @param context A pointer that is passed to the function (such as a pointer to the matrix)
+ * @param result An array of the resulting vector
+ * @param size The number of rows and columns of the operator
+ * @param settings A pointer to the tolerance, iteration limit, restart length and preconditioner
+ * @param report A pointer to where the iterations and final residual will be written (may be null)
+ * @param work A pointer to an arena with space for (restart+3)*size+(restart+4)*restart+1 elements (given back before returning)
+ * 
+ * @return 1 (true) if the solver converged, otherwise returns 0 (false)
+ */
+bool mxSolveGMRES(mxElement_t *write, mxOperator transform, void *context, const mxElement_t *result, int size, const mxKrylovSettings *settings, mxKrylovReport *report, mxArena *work);
+
+/*================================*/
+/* SIMD ================================*/
+
+/**
+ * The path is chosen once, from what the compiler targets and what the CPU supports (checked at runtime on x86).
+ * SIMD is only used when the elements are doubles
+ * 
+ * @return The SIMD path that the element loops use
+ */
+mxSimd mxSimdPath(void);
+
+/**
+ * @return The name of the SIMD path that the element loops use ("scalar", "SSE2", "AVX2" or "NEON")
+ */
+const char *mxSimdPathName(void);
+
 /*================================*/
 
 #ifdef __cplusplus
@@ -1,6 +1,6 @@
 // Programme to test the matrices library; Matrix
 // by Neo Vorsatz
-// Last updated: 25 December 2025
+// Last updated: 16 October 2026
 
 #include <stdio.h>
 
@@ -9,6 +9,9 @@
 #define MX_ELEMENT double
 #include "matrices.c"
 
+//Storage for the tests of large dynamic matrices
+static mxElement_t bigBuffer[16384];
+
 void printMatrix(const matrix *read) {
   for (unsigned int r=0; r<mxGetNumRows(read); r++) {
     for (unsigned int c=0; c<mxGetNumColumns(read); c++) {
@@ -19,6 +22,9 @@ void printMatrix(const matrix *read) {
 }
 
 int main() {
+  //Showing which SIMD path is used
+  printf("SIMD path: %s\n", mxSimdPathName());
+
   matrix m1;
   mxZero(&m1);
   mxSetSize(&m1, 3, 3);
@@ -84,22 +90,96 @@ int main() {
   printMatrix(&m1);
   printf("Determinant = %f\n",mxDeterminant(&m1));
 
+  //Decomposing the matrix
+  mxLUFactor factor;
+  mxLU(&factor, &m1);
+  printf("LU decomposition (packed):\n");
+  printMatrix(&factor.lu);
+  printf("Determinant from LU = %f | expected: 32.000000\n", mxLUDeterminant(&factor));
+
   //Generating new results using the same vectors
   mxMultiply(&result, &m1, &vectors);
   printf("New result, using same vectors:\n");
   printMatrix(&result);
 
+  //Accumulating another product into the result
+  matrix accumulated;
+  mxCopy(&accumulated, &result);
+  mxGemm(&accumulated, -1, &m1, &vectors, 2);
+  printf("Accumulating the negative product into double the result:\n");
+  printMatrix(&accumulated);
+  printf("Expected: the same result\n");
+
   //Solving for the vectors using Gauss
   mxSolveGauss(&solution, &m1, &result);
   printf("Solving for the vectors using Gauss:\n");
   printMatrix(&solution);
 
+  //Solving an inconsistent system, where the last row of the transform is the sum of the first two
+  matrix dependent, inconsistent, noSolution;
+  mxElement_t dependentElements[4][4] = {{-3,0,3,-3},{1,1,3,-3},{3,1,0,-3},{-2,1,6,-6}};
+  mxElement_t inconsistentElements[4][4] = {{4},{1},{1},{6}};
+  mxSet(&dependent, 4, 4, dependentElements);
+  mxSet(&inconsistent, 4, 1, inconsistentElements);
+  printf("Solving an inconsistent system using Gauss: %d | expected: 0\n", mxSolveGauss(&noSolution, &dependent, &inconsistent));
+
   //Solving for the vectors using inverse
   matrix solution2;
   mxSolveInverse(&solution2, &m1, &result);
   printf("Solving for the vectors using the inverse:\n");
   printMatrix(&solution2);
 
+  //Solving again from the LU decomposition
+  matrix solution3;
+  mxLUSolve(&solution3, &factor, &result);
+  printf("Solving for the vectors using the LU decomposition:\n");
+  printMatrix(&solution3);
+
+  //Solving again with mixed-precision refinement
+  mxRefineReport refineReport;
+  mxSolveRefined(&solution3, &m1, &result, &refineReport);
+  printf("Solving for the vectors with refinement:\n");
+  printMatrix(&solution3);
+  printf("Refinement converged: %d, with a residual below 1e-15: %d | expected: 1, 1\n", refineReport.converged, refineReport.residual<1e-15);
+
+  //Refining with the old decomposition after a small change to the transform, which needs refinement steps to make up the difference
+  matrix changed;
+  mxCopy(&changed, &m1);
+  for (unsigned int i=0; i<changed.rows; i++) {changed.elements[i][i] += 0.05;}
+  mxLUSolveRefined(&solution3, &factor, &changed, &result, &refineReport);
+  printf("Refining with an old decomposition took steps: %d, converged: %d, with a residual below 1e-15: %d | expected: 1, 1, 1\n", refineReport.iterations>0, refineReport.converged, refineReport.residual<1e-15);
+  printf("Refining without a report: %d | expected: 1\n", mxLUSolveRefined(&solution3, &factor, &changed, &result, 0));
+
+  //Solving a symmetric positive-definite system with Cholesky and LDL'
+  matrix symmetric, symmetricSolution;
+  mxElement_t symmetricElements[4][4] = {{4,-1,0,0},{-1,4,-1,0},{0,-1,4,0},{0,0,0,0}};
+  mxSet(&symmetric, 3, 3, symmetricElements);
+  mxMultiply(&symmetricSolution, &symmetric, &vectors);
+  mxSolveCholesky(&symmetricSolution, &symmetric, &symmetricSolution);
+  printf("Solving for the vectors using Cholesky:\n");
+  printMatrix(&symmetricSolution);
+  mxMultiply(&symmetricSolution, &symmetric, &vectors);
+  mxSolveLDL(&symmetricSolution, &symmetric, &symmetricSolution);
+  printf("Solving for the vectors using LDL':\n");
+  printMatrix(&symmetricSolution);
+  printf("Expected: the vectors\n");
+  //A singular matrix fails partway through both decompositions (in place), and must be left unchanged
+  matrix semidefinite;
+  mxElement_t semidefiniteElements[4][4] = {{4,2,0},{2,1,0},{0,0,1}};
+  mxSet(&semidefinite, 3, 3, semidefiniteElements);
+  bool decomposed = mxCholesky(&semidefinite, &semidefinite);
+  decomposed = mxLDL(&semidefinite, &semidefinite)||decomposed;
+  printf("Failed decompositions: %d, left unchanged: %d, %d | expected: 0, 1, 1\n", decomposed, semidefinite.elements[0][0]==4, semidefinite.elements[1][0]==2);
+
+  //Fitting a line through 4 points, using least squares
+  matrix points, heights, line;
+  mxElement_t pointElements[4][4] = {{0,1},{1,1},{2,1},{3,1}};
+  mxElement_t heightElements[4][4] = {{1.1},{2.9},{5.1},{6.9}};
+  mxSet(&points, 4, 2, pointElements);
+  mxSet(&heights, 4, 1, heightElements);
+  mxSolveLeastSquares(&line, &points, &heights);
+  printf("Line of best fit: slope %f, intercept %f | expected: slope 1.960000, intercept 1.060000\n", mxReadElement(&line, 0, 0), mxReadElement(&line, 1, 0));
+
   //Testing if the solutions are the same
   if (mxEqual(&solution, &solution2)) {
     printf("The solutions are the same:)\n");
@@ -121,6 +201,368 @@ int main() {
     printf("Equality unsuccesful\n");
   }
   
+  //Testing dynamic matrices, over storage from an arena
+  mxElement_t buffer[64];
+  mxArena arena;
+  mxArenaInit(&arena, buffer, 64);
+  mxDyn dynTransform, dynResult, dynSolution;
+  mxDynAlloc(&dynTransform, &arena, 3, 3);
+  mxDynAlloc(&dynResult, &arena, 3, 2);
+  mxDynAlloc(&dynSolution, &arena, 3, 2);
+  mxDynFromMatrix(&dynTransform, &m1);
+  mxDynFromMatrix(&dynResult, &result);
+  mxDynSolveGauss(&dynSolution, &dynTransform, &dynResult, &arena);
+  printf("Solving for the vectors using dynamic matrices:\n");
+  mxDynToMatrix(&solution2, &dynSolution);
+  printMatrix(&solution2);
+  printf("Arena elements used: %u | expected: 21\n", arena.used);
+  mxDynTranspose_inplace(&dynTransform);
+  printf("Dynamic transform transposed in place, row 0 column 1: %f | expected: %f\n", mxDynReadElement(&dynTransform, 0, 1), mxReadElement(&m1, 1, 0));
+
+  //Testing a multiplication big enough to use cache blocks (with a partial block of rows, of terms and of columns)
+  mxArena bigArena;
+  mxArenaInit(&bigArena, bigBuffer, 16384);
+  mxDyn big1, big2, bigProduct;
+  mxDynAlloc(&big1, &bigArena, 37, 137);
+  mxDynAlloc(&big2, &bigArena, 137, 11);
+  mxDynAlloc(&bigProduct, &bigArena, 37, 11);
+  for (unsigned int r=0; r<37; r++) {
+    for (unsigned int c=0; c<137; c++) {mxDynWriteElement(&big1, r, c, (double)((r*7+c*3)%11)-5);}
+  }
+  for (unsigned int r=0; r<137; r++) {
+    for (unsigned int c=0; c<11; c++) {mxDynWriteElement(&big2, r, c, (double)((r*5+c*2)%13)/4-1);}
+  }
+  for (unsigned int r=0; r<37; r++) {
+    for (unsigned int c=0; c<11; c++) {mxDynWriteElement(&bigProduct, r, c, r+c);}
+  }
+  //Product = 2*Big1*Big2 - Product, checked against the product found one term at a time
+  mxDynGemm(&bigProduct, 2, &big1, &big2, -1, &bigArena);
+  double bigError = 0;
+  for (unsigned int r=0; r<37; r++) {
+    for (unsigned int c=0; c<11; c++) {
+      double sum = 0;
+      for (unsigned int i=0; i<137; i++) {sum += mxDynReadElement(&big1, r, i)*mxDynReadElement(&big2, i, c);}
+      double error = fabs(mxDynReadElement(&bigProduct, r, c)-(2*sum-(r+c)));
+      if (error>bigError) {bigError = error;}
+    }
+  }
+  printf("Blocked multiplication matches: %d | expected: 1\n", bigError<1e-12);
+
+  //Testing transposes big enough to be split into blocks, out of place and in place (with room after each row, which must stay untouched)
+  mxArenaInit(&bigArena, bigBuffer, 16384);
+  mxDyn tall, wide, bigSquare;
+  mxDynAlloc(&tall, &bigArena, 100, 37);
+  mxDynAlloc(&wide, &bigArena, 37, 100);
+  mxDynInit_stride(&bigSquare, mxArenaAlloc(&bigArena, 53*60), 53, 53, 60);
+  for (unsigned int r=0; r<100; r++) {
+    for (unsigned int c=0; c<37; c++) {mxDynWriteElement(&tall, r, c, r*37+c);}
+  }
+  for (unsigned int r=0; r<53; r++) {
+    for (unsigned int c=0; c<60; c++) {bigSquare.elements[r*60+c] = c<53? (double)(r*53+c):-1;}
+  }
+  mxDynTranspose(&wide, &tall);
+  mxDynTranspose_inplace(&bigSquare);
+  bool transposeMatches = 1;
+  for (unsigned int r=0; r<37; r++) {
+    for (unsigned int c=0; c<100; c++) {transposeMatches = transposeMatches&&(mxDynReadElement(&wide, r, c)==c*37+r);}
+  }
+  printf("Blocked transpose matches: %d | expected: 1\n", transposeMatches);
+  transposeMatches = 1;
+  for (unsigned int r=0; r<53; r++) {
+    for (unsigned int c=0; c<53; c++) {transposeMatches = transposeMatches&&(mxDynReadElement(&bigSquare, r, c)==c*53+r);}
+    for (unsigned int c=53; c<60; c++) {transposeMatches = transposeMatches&&(bigSquare.elements[r*60+c]==-1);}
+  }
+  printf("Blocked transpose in place matches: %d | expected: 1\n", transposeMatches);
+
+  //Testing Reduced Row Echelon Form of dynamic matrices, where the pivots are found in an order that's one cycle of all 4 rows,
+  //with the identity as collateral (so the collateral times the matrix is its reduced form)
+  mxArenaInit(&bigArena, bigBuffer, 16384);
+  mxElement_t cycleElements[4][4] = {{0,0,0,2},{3,1,0,0},{0,4,1,0},{1,0,5,1}};
+  matrix cycle, cycleReduced, cycleCollateral, cycleProduct;
+  mxSet(&cycle, 4, 4, cycleElements);
+  mxIdentity(&cycleCollateral, 4);
+  mxDyn dynCycle, dynReduced, dynIdentity, dynCollateral;
+  mxDynAlloc(&dynCycle, &bigArena, 4, 4);
+  mxDynAlloc(&dynReduced, &bigArena, 4, 4);
+  mxDynAlloc(&dynIdentity, &bigArena, 4, 4);
+  mxDynAlloc(&dynCollateral, &bigArena, 4, 4);
+  mxDynFromMatrix(&dynCycle, &cycle);
+  mxDynFromMatrix(&dynIdentity, &cycleCollateral);
+  unsigned int usedBefore = bigArena.used;
+  mxDynReducedEchelon_coll(&dynReduced, &dynCollateral, &dynCycle, &dynIdentity, &bigArena);
+  mxDynToMatrix(&cycleReduced, &dynReduced);
+  mxDynToMatrix(&cycleCollateral, &dynCollateral);
+  mxMultiply(&cycleProduct, &cycleCollateral, &cycle);
+  double cycleError = 0;
+  bool diagonal = 1;
+  for (unsigned int r=0; r<4; r++) {
+    for (unsigned int c=0; c<4; c++) {
+      cycleError = fmax(cycleError, fabs(cycleProduct.elements[r][c]-cycleReduced.elements[r][c]));
+      diagonal = diagonal&&((r==c)? cycleReduced.elements[r][c]!=0:fabs(cycleReduced.elements[r][c])<1e-12);
+    }
+  }
+  printf("Dynamic reduced form is diagonal: %d, and the collateral times the matrix: %d | expected: 1, 1\n", diagonal, cycleError<1e-12);
+  printf("Arena elements given back: %d | expected: 1\n", bigArena.used==usedBefore);
+
+  //Testing transposes of a non-square matrix (which only move the elements inside the matrix)
+  matrix transposed = vectors;
+  mxTranspose_inplace(&transposed);
+  printf("Vectors transposed in place:\n");
+  printMatrix(&transposed);
+  printf("Expected: 12, 0, 4 and -6, 18, -11\n");
+  matrix transposedCopy;
+  mxTranspose(&transposedCopy, &vectors);
+  printf("Vectors transposed into another matrix:\n");
+  printMatrix(&transposedCopy);
+  printf("Expected: 12, 0, 4 and -6, 18, -11\n");
+
+  //Testing the written-out 4x4 functions
+  matrix square, squareInverse, squareProduct;
+  mxElement_t squareElements[4][4] = {{4,1,0,2},{1,3,1,0},{0,2,5,1},{3,0,1,6}};
+  mxSet(&square, 4, 4, squareElements);
+  printf("4x4 determinant: %f | expected: 186.000000\n", mxDeterminant4(&square));
+  mxInverse4(&squareInverse, &square);
+  mxMultiply4(&squareProduct, &square, &squareInverse);
+  printf("4x4 matrix times its inverse:\n");
+  printMatrix(&squareProduct);
+  printf("Expected: the identity matrix\n");
+
+  //Testing Gauss-Jordan elimination, which mxInverse only uses above the written-out sizes (so it's called directly here)
+  matrix single, singleInverse;
+  mxElement_t singleElements[4][4] = {{4}};
+  mxSet(&single, 1, 1, singleElements);
+  mxInverse(&singleInverse, &single);
+  single.elements[0][0] = 0;
+  bool inverted = mxInverse(&singleInverse, &single);
+  printf("1x1 inverse of 4, then of 0: %f, %d | expected: 0.250000, 0\n", singleInverse.elements[0][0], inverted);
+#ifndef MX_EXACT
+  //The first column needs a row swap, since its first element is zero
+  mxElement_t pivotingElements[4][4] = {{0,2,1,0},{1,1,0,2},{2,0,1,1},{0,1,3,1}};
+  mxSet(&square, 4, 4, pivotingElements);
+  mxInverseGaussJordan(&squareInverse, &square);
+  mxMultiply4(&squareProduct, &square, &squareInverse);
+  printf("4x4 matrix times its Gauss-Jordan inverse (with a row swap):\n");
+  printMatrix(&squareProduct);
+  printf("Expected: the identity matrix\n");
+  squareProduct = squareInverse;
+  inverted = mxInverseGaussJordan(&squareInverse, &dependent);
+  printf("Gauss-Jordan inverse of a singular matrix: %d, left unchanged: %d | expected: 0, 1\n", inverted, mxEqual(&squareInverse, &squareProduct));
+#endif
+
+  //Testing a sparse matrix, built from triplets (the diagonal is given in two halves)
+  unsigned int tripletRows[8] = {0,1,2,0,1,1,2,0};
+  unsigned int tripletColumns[8] = {0,1,2,1,0,2,1,0};
+  mxElement_t tripletValues[8] = {2,4,4,-1,-1,-1,-1,2};
+  mxSparse sparse;
+  mxSparseAlloc(&sparse, &arena, 3, 3, 8);
+  mxSparseFromTriplets(&sparse, tripletRows, tripletColumns, tripletValues, 8);
+  printf("Sparse elements stored: %u | expected: 7\n", sparse.rowStart[3]);
+  mxSparseFactor sparseFactor;
+  mxElement_t sparseVector[3] = {3,2,3};
+  mxSparseCholesky(&sparseFactor, &sparse, &arena);
+  mxSparseCholeskySolve(sparseVector, &sparseFactor, sparseVector, &arena);
+  printf("Sparse solution: %f, %f, %f | expected: 1.000000, 1.000000, 1.000000\n", sparseVector[0], sparseVector[1], sparseVector[2]);
+
+  //Testing a batch, stored element by element across the matrices
+  matrix pair[2] = {m1, m1};
+  mxScale_inplace(&pair[1], 2);
+  mxElement_t batchStorage[3*3*2];
+  mxBatch batch;
+  mxBatchInit(&batch, batchStorage, 3, 3, 2);
+  mxBatchPack(&batch, pair);
+  mxElement_t determinants[2];
+  mxBatchDeterminant(determinants, &batch);
+  printf("Batch determinants: %f, %f | expected: %f, %f\n", determinants[0], determinants[1], mxDeterminant(&m1), 8*mxDeterminant(&m1));
+
+  //Testing batches of 11 matrices, so the last group of 8 lanes is only partly filled
+  matrix batchMatrices[11], batchInverses[11], batchProducts[11], batchUnpacked[11];
+  for (unsigned int k=0; k<11; k++) {
+    mxElement_t batchElements[4][4];
+    for (unsigned int r=0; r<3; r++) {
+      for (unsigned int c=0; c<3; c++) {batchElements[r][c] = (r==c)? 10+k:(double)((r*3+c*5+k*7)%9)-4;}
+    }
+    mxSet(&batchMatrices[k], 3, 3, batchElements);
+  }
+  double batchError = 0;
+  mxInverseBatch(batchInverses, batchMatrices, 11);
+  mxMultiplyBatch(batchProducts, batchMatrices, batchInverses, 11);
+  for (unsigned int k=0; k<11; k++) {
+    for (unsigned int r=0; r<3; r++) {
+      for (unsigned int c=0; c<3; c++) {batchError = fmax(batchError, fabs(batchProducts[k].elements[r][c]-(r==c)));}
+    }
+  }
+  printf("Each matrix times its inverse from the array functions is the identity: %d | expected: 1\n", batchError<1e-12);
+  mxElement_t batchStorage1[3*3*11], batchStorage2[3*3*11], batchStorage3[3*3*11];
+  mxBatch batchPacked, batchInverse, batchProduct;
+  mxBatchInit(&batchPacked, batchStorage1, 3, 3, 11);
+  mxBatchInit(&batchInverse, batchStorage2, 3, 3, 11);
+  mxBatchInit(&batchProduct, batchStorage3, 3, 3, 11);
+  mxBatchPack(&batchPacked, batchMatrices);
+  mxBatchInverse(&batchInverse, &batchPacked);
+  mxBatchMultiply(&batchProduct, &batchPacked, &batchInverse);
+  mxBatchUnpack(batchProducts, &batchProduct);
+  mxBatchUnpack(batchUnpacked, &batchPacked);
+  batchError = 0;
+  for (unsigned int k=0; k<11; k++) {
+    for (unsigned int r=0; r<3; r++) {
+      for (unsigned int c=0; c<3; c++) {
+        batchError = fmax(batchError, fabs(batchProducts[k].elements[r][c]-(r==c)));
+        batchError = fmax(batchError, fabs(batchUnpacked[k].elements[r][c]-batchMatrices[k].elements[r][c]));
+      }
+    }
+  }
+  printf("Each matrix times its inverse from a batch is the identity, and unpacks unchanged: %d | expected: 1\n", batchError<1e-12);
+  mxElement_t batchDeterminants[11], arrayDeterminants[11];
+  mxBatchDeterminant(batchDeterminants, &batchPacked);
+  mxDeterminantBatch(arrayDeterminants, batchMatrices, 11);
+  batchError = 0;
+  for (unsigned int k=0; k<11; k++) {
+    batchError = fmax(batchError, fabs(batchDeterminants[k]-mxDeterminant(&batchMatrices[k]))/fabs(mxDeterminant(&batchMatrices[k])));
+    batchError = fmax(batchError, fabs(arrayDeterminants[k]-mxDeterminant(&batchMatrices[k]))/fabs(mxDeterminant(&batchMatrices[k])));
+  }
+  printf("Determinants of the batch and the array match: %d | expected: 1\n", batchError<1e-12);
+
+  //Testing the eigenvalues of a symmetric matrix, and the eigenvector of the largest one
+  matrix chain, eigenvector;
+  mxElement_t chainElements[4][4] = {{2,-1,0,0},{-1,2,-1,0},{0,-1,2,0},{0,0,0,0}};
+  mxSet(&chain, 3, 3, chainElements);
+  mxElement_t eigenvalues[3];
+  mxEigen(eigenvalues, 0, &chain);
+  printf("Eigenvalues: %f, %f, %f | expected: 3.414214, 2.000000, 0.585786\n", eigenvalues[0], eigenvalues[1], eigenvalues[2]);
+  mxEigen_top(eigenvalues, &eigenvector, &chain, 1);
+  printf("Largest eigenvector: %f, %f, %f | expected: 0.500000, -0.707107, 0.500000 (or negated)\n", eigenvector.elements[0][0], eigenvector.elements[1][0], eigenvector.elements[2][0]);
+  //A matrix with a NaN never converges, and must leave the eigenvectors unchanged (including their size)
+  matrix unconverged = chain, keptVectors, identity2;
+  unconverged.elements[0][1] = NAN;
+  unconverged.elements[1][0] = NAN;
+  mxIdentity(&keptVectors, 2);
+  mxIdentity(&identity2, 2);
+  bool converged = mxEigen_top(eigenvalues, &keptVectors, &unconverged, 1);
+  printf("Eigenvectors of a NaN matrix: %d, left unchanged: %d | expected: 0, 1\n", converged, mxEqual(&keptVectors, &identity2));
+
+  //Testing the rank and pseudo-inverse of a rank-deficient matrix
+  matrix deficient, pseudo;
+  mxElement_t deficientElements[4][4] = {{1,2,3,0},{2,4,6,0},{1,0,1,0},{0,0,0,0}};
+  mxSet(&deficient, 3, 3, deficientElements);
+  printf("Rank: %d | expected: 2\n", mxRank(&deficient));
+  mxPseudoInverse(&pseudo, &deficient);
+  matrix pseudoCheck;
+  mxMultiply(&pseudoCheck, &deficient, &pseudo);
+  mxMultiply(&pseudoCheck, &pseudoCheck, &deficient);
+  printf("Matrix times its pseudo-inverse times the matrix:\n");
+  printMatrix(&pseudoCheck);
+  printf("Expected: 1, 2, 3 and 2, 4, 6 and 1, 0, 1\n");
+
+  //Testing a tridiagonal system, solved with the Thomas algorithm and with a banded decomposition (in a fresh arena)
+  mxArenaReset(&arena);
+  mxElement_t tridiagonalLower[3] = {-1,-1,-1};
+  mxElement_t tridiagonalDiagonal[4] = {2,2,2,2};
+  mxElement_t tridiagonalUpper[3] = {-1,-1,-1};
+  mxElement_t tridiagonalResult[4] = {1,0,0,1};
+  mxElement_t tridiagonalSolution[4];
+  mxSolveTridiagonal(tridiagonalSolution, tridiagonalLower, tridiagonalDiagonal, tridiagonalUpper, tridiagonalResult, 4, &arena);
+  printf("Tridiagonal solution: %f, %f, %f, %f | expected: 1.000000, 1.000000, 1.000000, 1.000000\n", tridiagonalSolution[0], tridiagonalSolution[1], tridiagonalSolution[2], tridiagonalSolution[3]);
+  mxBand band;
+  unsigned int bandPivots[4];
+  mxBandAlloc(&band, &arena, 4, 1, 1);
+  for (int i=0; i<4; i++) {
+    mxBandWriteElement(&band, i, i, (i==0)? 0:2);
+    mxBandWriteElement(&band, i, i-1, -1);
+    mxBandWriteElement(&band, i, i+1, -1);
+  }
+  mxBandLU(&band, bandPivots);
+  mxBandLUSolve(tridiagonalSolution, &band, bandPivots, tridiagonalResult);
+  printf("Banded solution (with a zero on the diagonal): %f, %f, %f, %f | expected: -1.666667, -1.000000, -0.333333, 0.333333\n", tridiagonalSolution[0], tridiagonalSolution[1], tridiagonalSolution[2], tridiagonalSolution[3]);
+
+  //Testing the conjugate gradient method, with the same sparse matrix as before
+  mxSparseAlloc(&sparse, &arena, 3, 3, 8);
+  mxSparseFromTriplets(&sparse, tripletRows, tripletColumns, tripletValues, 8);
+  mxKrylovSettings settings;
+  mxKrylovReport report;
+  mxKrylovDefaults(&settings);
+  mxElement_t iterativeResult[3] = {3,2,3};
+  mxElement_t iterativeSolution[3] = {0,0,0};
+  mxSolveCG(iterativeSolution, mxOperatorSparse, &sparse, iterativeResult, 3, &settings, &report, &arena);
+  printf("Conjugate gradient solution: %f, %f, %f | expected: 1.000000, 1.000000, 1.000000\n", iterativeSolution[0], iterativeSolution[1], iterativeSolution[2]);
+  printf("Iterations: %u | expected: at most 3\n", report.iterations);
+
+  //Testing GMRES (with an ILU(0) preconditioner) and BiCGSTAB (without one, then with a Jacobi one) on a nonsymmetric
+  //sparse matrix, whose pattern makes ILU(0) only an approximation, with a solution of 1, 2, 3, ...
+  mxArenaInit(&bigArena, bigBuffer, 16384);
+  unsigned int nonsymmetricRows[29], nonsymmetricColumns[29];
+  mxElement_t nonsymmetricValues[29];
+  unsigned int nonsymmetricCount = 0;
+  for (unsigned int i=0; i<8; i++) {
+    nonsymmetricRows[nonsymmetricCount] = i; nonsymmetricColumns[nonsymmetricCount] = i; nonsymmetricValues[nonsymmetricCount++] = 4+i%3;
+    if (i>0) {nonsymmetricRows[nonsymmetricCount] = i; nonsymmetricColumns[nonsymmetricCount] = i-1; nonsymmetricValues[nonsymmetricCount++] = -1.5;}
+    if (i<7) {nonsymmetricRows[nonsymmetricCount] = i; nonsymmetricColumns[nonsymmetricCount] = i+1; nonsymmetricValues[nonsymmetricCount++] = -0.5;}
+    if (i<5) {nonsymmetricRows[nonsymmetricCount] = i; nonsymmetricColumns[nonsymmetricCount] = i+3; nonsymmetricValues[nonsymmetricCount++] = 0.7;}
+  }
+  mxSparse nonsymmetric;
+  mxSparseAlloc(&nonsymmetric, &bigArena, 8, 8, nonsymmetricCount);
+  mxSparseFromTriplets(&nonsymmetric, nonsymmetricRows, nonsymmetricColumns, nonsymmetricValues, nonsymmetricCount);
+  mxElement_t nonsymmetricExpected[8] = {1,2,3,4,5,6,7,8};
+  mxElement_t nonsymmetricResult[8], nonsymmetricSolution[8];
+  mxSparseMultiplyVector(nonsymmetricResult, &nonsymmetric, nonsymmetricExpected);
+  mxILU ilu;
+  mxJacobi jacobi;
+  mxILUInit(&ilu, &nonsymmetric, &bigArena);
+  mxJacobiInit(&jacobi, &nonsymmetric, &bigArena);
+  for (unsigned int method=0; method<3; method++) {
+    mxKrylovDefaults(&settings);
+    if (method==0) {settings.preconditioner = mxILUApply; settings.preconditionerContext = &ilu;}
+    if (method==2) {settings.preconditioner = mxJacobiApply; settings.preconditionerContext = &jacobi;}
+    for (unsigned int i=0; i<8; i++) {nonsymmetricSolution[i] = 0;}
+    bool converged;
+    if (method==0) {converged = mxSolveGMRES(nonsymmetricSolution, mxOperatorSparse, &nonsymmetric, nonsymmetricResult, 8, &settings, &report, &bigArena);}
+    else {converged = mxSolveBiCGSTAB(nonsymmetricSolution, mxOperatorSparse, &nonsymmetric, nonsymmetricResult, 8, &settings, &report, &bigArena);}
+    double nonsymmetricError = 0;
+    for (unsigned int i=0; i<8; i++) {nonsymmetricError = fmax(nonsymmetricError, fabs(nonsymmetricSolution[i]-nonsymmetricExpected[i]));}
+    printf("%s: converged %d, solution matches %d | expected: converged 1, solution matches 1\n", method==0? "GMRES with ILU(0)":method==1? "BiCGSTAB":"BiCGSTAB with Jacobi", converged, nonsymmetricError<1e-8);
+    printf("Iterations: %u, residual: %g | expected: %s, below 1e-10\n", report.iterations, report.residual, method==0? "fewer than 8":"at most 16");
+  }
+
+  //Testing views: scaling a block of a matrix in place, and the determinant of a minor
+  matrix viewed = m1;
+  mxView view, block, minor;
+  mxViewMatrix(&view, &viewed);
+  mxViewBlock(&block, &view, 1, 1, 2, 2);
+  mxViewScale(&block, &block, 10);
+  mxViewMinor(&minor, &view, 0, 0);
+  printf("Determinant of the scaled block, through a minor: %f | expected: %f\n", mxViewDeterminant(&minor), 100*(m1.elements[1][1]*m1.elements[2][2]-m1.elements[1][2]*m1.elements[2][1]));
+
+  //Testing the matrix exponential (a rotation), and discretising a double integrator with a zero-order hold
+  matrix generator, rotation, stateA, stateB;
+  mxElement_t generatorElements[4][4] = {{0,1},{-1,0}};
+  mxSet(&generator, 2, 2, generatorElements);
+  mxExp(&rotation, &generator);
+  printf("Exponential: %f, %f | expected: 0.540302, 0.841471\n", rotation.elements[0][0], rotation.elements[0][1]);
+  mxElement_t integratorA[4][4] = {{0,1},{0,0}};
+  mxElement_t integratorB[4][4] = {{0},{1}};
+  mxSet(&stateA, 2, 2, integratorA);
+  mxSet(&stateB, 2, 1, integratorB);
+  mxDiscretise(&stateA, &stateB, &stateA, &stateB, 0.1);
+  printf("Discrete model: Ad[0][1] = %f, Bd = %f, %f | expected: 0.100000, 0.005000, 0.100000\n", stateA.elements[0][1], stateB.elements[0][0], stateB.elements[1][0]);
+
+  //Testing a rank-1 update of an inverse (adding 1 to the first row), and of a Cholesky decomposition
+  matrix updated, updateU, updateV;
+  mxElement_t updatedElements[4][4] = {{0.5,0},{0,0.25}};
+  mxElement_t updateUElements[4][4] = {{1},{0}};
+  mxElement_t updateVElements[4][4] = {{1},{1}};
+  mxSet(&updated, 2, 2, updatedElements);
+  mxSet(&updateU, 2, 1, updateUElements);
+  mxSet(&updateV, 2, 1, updateVElements);
+  mxInverseUpdate(&updated, &updateU, &updateV);
+  printf("Updated inverse: %f, %f, %f, %f | expected: 0.333333, -0.083333, 0.000000, 0.250000\n", updated.elements[0][0], updated.elements[0][1], updated.elements[1][0], updated.elements[1][1]);
+  mxElement_t choleskyElements[4][4] = {{2,0},{0,2}};
+  mxElement_t choleskyVector[4][4] = {{2},{0}};
+  mxSet(&updated, 2, 2, choleskyElements);
+  mxSet(&updateU, 2, 1, choleskyVector);
+  mxCholeskyUpdate(&updated, &updateU);
+  printf("Updated Cholesky diagonal: %f, %f | expected: 2.828427, 2.000000\n", updated.elements[0][0], updated.elements[1][1]);
+  mxCholeskyDowndate(&updated, &updateU);
+  printf("Downdated Cholesky diagonal: %f, %f | expected: 2.000000, 2.000000\n", updated.elements[0][0], updated.elements[1][1]);
+
   //Finished
   return 0;
 }
\ No newline at end of file